@@ -0,0 +1,184 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#include "StdH.h"
+#include "BotBenchmark.h"
+
+#include <windows.h>
+#include <psapi.h>
+
+#pragma comment(lib, "psapi.lib")
+
+// [Cecil] 2026-10-19: Benchmark state
+static BOOL _bBenchmarking = FALSE;
+static CTFileName _fnBenchmarkDemo;
+static FLOAT _fOldRealTimeFactor = 1.0f;
+
+// Time when the demo started and when the current tick started
+static CTimerValue _tvBenchmarkStart;
+static CTimerValue _tvTickStart;
+static CTimerValue _tvThinkStart;
+
+// Collected data
+static CStaticStackArray<DOUBLE> _adTickTimes;
+static CStaticStackArray<DOUBLE> _adThinkTimes;
+static DOUBLE _dEntitiesSum = 0.0;
+static INDEX _ctEntitiesMax = 0;
+static INDEX _ctBotsMax = 0;
+
+// How fast the demo should be played
+#define BENCHMARK_DEMO_SPEED 1000.0f
+
+// Get peak memory usage of the process in bytes
+static SIZE_T PeakMemoryUsage(void) {
+  PROCESS_MEMORY_COUNTERS pmc;
+  pmc.cb = sizeof(pmc);
+
+  if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) {
+    return 0;
+  }
+
+  return Max(pmc.PeakWorkingSetSize, pmc.PeakPagefileUsage);
+};
+
+// Total time spent on bot thinking so far
+static CTimerValue BotThinkTime(void) {
+  return _pfBotModProfile.pf_aptTimers[CBotModProfile::PTI_THINKING].pt_tvElapsed;
+};
+
+static int qsort_CompareTimes(const void *pv0, const void *pv1) {
+  const DOUBLE d0 = *(const DOUBLE *)pv0;
+  const DOUBLE d1 = *(const DOUBLE *)pv1;
+
+  if (d0 < d1) return -1;
+  if (d0 > d1) return +1;
+  return 0;
+};
+
+// Print statistics of recorded times in milliseconds
+static CTString TimeStats(CStaticStackArray<DOUBLE> &adTimes) {
+  const INDEX ct = adTimes.Count();
+  CTString strStats;
+
+  if (ct <= 0) {
+    return "{ \"avg\": 0, \"p50\": 0, \"p90\": 0, \"p99\": 0, \"max\": 0 }";
+  }
+
+  qsort(&adTimes[0], ct, sizeof(DOUBLE), qsort_CompareTimes);
+
+  DOUBLE dSum = 0.0;
+
+  for (INDEX i = 0; i < ct; i++) {
+    dSum += adTimes[i];
+  }
+
+  #define PERCENTILE(_Percent) (adTimes[Clamp(INDEX(ct * _Percent / 100), (INDEX)0, ct - 1)] * 1000.0)
+
+  strStats.PrintF("{ \"avg\": %.4f, \"p50\": %.4f, \"p90\": %.4f, \"p99\": %.4f, \"max\": %.4f }",
+    dSum / ct * 1000.0, PERCENTILE(50), PERCENTILE(90), PERCENTILE(99), adTimes[ct - 1] * 1000.0);
+
+  #undef PERCENTILE
+
+  return strStats;
+};
+
+// Start collecting benchmark data for the demo that's about to be played
+void CECIL_BeginBotBenchmark(const CTFileName &fnDemo) {
+  _fnBenchmarkDemo = fnDemo;
+
+  _adTickTimes.PopAll();
+  _adThinkTimes.PopAll();
+  _dEntitiesSum = 0.0;
+  _ctEntitiesMax = 0;
+  _ctBotsMax = 0;
+
+  // Play the demo as fast as possible
+  // (keep the original factor if restarted mid-benchmark, otherwise the benchmark speed is restored afterwards)
+  if (!_bBenchmarking) {
+    _fOldRealTimeFactor = _pShell->GetFLOAT("dem_fRealTimeFactor");
+  }
+  _pShell->SetFLOAT("dem_fRealTimeFactor", BENCHMARK_DEMO_SPEED);
+
+  _tvBenchmarkStart = _pTimer->GetHighPrecisionTimer();
+  _bBenchmarking = TRUE;
+
+  CPrintF("Benchmarking bots in '%s'...\n", fnDemo.str_String);
+};
+
+// Stop collecting benchmark data and optionally write the report next to the demo
+void CECIL_EndBotBenchmark(BOOL bWriteReport) {
+  if (!_bBenchmarking) return;
+
+  _bBenchmarking = FALSE;
+  _pShell->SetFLOAT("dem_fRealTimeFactor", _fOldRealTimeFactor);
+
+  if (!bWriteReport) {
+    CPrintF("Bot benchmark has been cancelled\n");
+    return;
+  }
+
+  const DOUBLE dWallTime = (_pTimer->GetHighPrecisionTimer() - _tvBenchmarkStart).GetSeconds();
+  const INDEX ctTicks = _adTickTimes.Count();
+  const CTFileName fnReport = _fnBenchmarkDemo.NoExt() + ".json";
+
+  try {
+    CTFileStream strm;
+    strm.Create_t(fnReport, CTStream::CM_TEXT);
+
+    strm.FPrintF_t("{\n");
+    strm.FPrintF_t("  \"demo\": \"%s\",\n", _fnBenchmarkDemo.FileName().str_String);
+    strm.FPrintF_t("  \"wall_time_s\": %.3f,\n", dWallTime);
+    strm.FPrintF_t("  \"ticks\": %d,\n", ctTicks);
+    strm.FPrintF_t("  \"tick_ms\": %s,\n", TimeStats(_adTickTimes).str_String);
+    strm.FPrintF_t("  \"bot_think_ms\": %s,\n", TimeStats(_adThinkTimes).str_String);
+    strm.FPrintF_t("  \"bots_max\": %d,\n", _ctBotsMax);
+    strm.FPrintF_t("  \"entities_avg\": %.1f,\n", (ctTicks > 0 ? _dEntitiesSum / ctTicks : 0.0));
+    strm.FPrintF_t("  \"entities_max\": %d,\n", _ctEntitiesMax);
+    strm.FPrintF_t("  \"memory_peak_kb\": %u\n", ULONG(PeakMemoryUsage() / 1024));
+    strm.FPrintF_t("}\n");
+
+    CPrintF("Bot benchmark report saved into '%s' (%d ticks in %.2fs)\n", fnReport.str_String, ctTicks, dWallTime);
+
+  } catch (char *strError) {
+    CPrintF("Cannot write bot benchmark report: %s\n", strError);
+  }
+};
+
+// Check if currently benchmarking
+BOOL CECIL_IsBotBenchmarkActive(void) {
+  return _bBenchmarking;
+};
+
+// Measure one game tick
+void CECIL_BotBenchmarkTickStart(void) {
+  if (!_bBenchmarking) return;
+
+  _tvThinkStart = BotThinkTime();
+  _tvTickStart = _pTimer->GetHighPrecisionTimer();
+};
+
+void CECIL_BotBenchmarkTickEnd(void) {
+  if (!_bBenchmarking) return;
+
+  _adTickTimes.Push() = (_pTimer->GetHighPrecisionTimer() - _tvTickStart).GetSeconds();
+
+  // Profile might have been reset in the middle of the tick
+  _adThinkTimes.Push() = ClampDn((BotThinkTime() - _tvThinkStart).GetSeconds(), 0.0);
+
+  const INDEX ctEntities = _pNetwork->ga_World.wo_cenEntities.Count();
+  _dEntitiesSum += ctEntities;
+  _ctEntitiesMax = Max(_ctEntitiesMax, ctEntities);
+  _ctBotsMax = Max(_ctBotsMax, _aPlayerBots.Count());
+};
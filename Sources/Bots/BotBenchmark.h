@@ -0,0 +1,35 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#ifndef _CECILBOTS_BOTBENCHMARK_H
+#define _CECILBOTS_BOTBENCHMARK_H
+
+// [Cecil] 2026-10-19: Directory with benchmark demos of bot matches
+#define BOT_BENCHMARK_DIR "Cecil\\Benchmarks\\"
+
+// Start collecting benchmark data for the demo that's about to be played
+DECL_DLL void CECIL_BeginBotBenchmark(const CTFileName &fnDemo);
+
+// Stop collecting benchmark data and optionally write the report next to the demo
+DECL_DLL void CECIL_EndBotBenchmark(BOOL bWriteReport);
+
+// Check if currently benchmarking
+DECL_DLL BOOL CECIL_IsBotBenchmarkActive(void);
+
+// Measure one game tick
+void CECIL_BotBenchmarkTickStart(void);
+void CECIL_BotBenchmarkTickEnd(void);
+
+#endif // _CECILBOTS_BOTBENCHMARK_H
@@ -16,6 +16,7 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #include "StdH.h"
 #include "BotModMain.h"
 #include "Bots/Logic/BotFunctions.h"
+#include "Bots/PathFinding/NavmeshLoader.h"
 
 // [Cecil] 2019-05-28: NavMesh Commands
 INDEX MOD_iRenderNavMesh = 0; // NavMesh render mode (0 - disabled, 1 - points, 2 - connections, 3 - IDs, 4 - flags)
@@ -24,6 +25,7 @@ FLOAT MOD_fNavMeshRenderRange = 0.0f; // NavMesh point rendering range (0 - infi
 INDEX MOD_iNavMeshRangeModel = 0; // NavMesh point range model (0 - flat, 1 - circle, 2 - sphere)
 INDEX MOD_iNavMeshPoint = -1; // Currently selected NavMesh point
 INDEX MOD_iNavMeshConnecting = 0; // Connecting mode (0 - disabled, 1 - to point, 2 - to each other, 3 - others to this one)
+INDEX MOD_iNavMeshLabels = 32; // [Cecil] 2026-10-19: Maximum amount of point labels (nearest points first)
 
 extern INDEX MOD_bEntityIDs;
 extern INDEX MOD_bBotThoughts;
@@ -47,6 +49,76 @@ INDEX FindBotByPointer(CPlayerEntity *pen) {
   return -1;
 };
 
+// [Cecil] 2026-10-19: Let bots reconsider their paths when points on them get locked or unlocked
+static void BotLockChanged(CBotPathPoint **apbppChanged, INDEX ctChanged, void *pData) {
+  static CStaticStackArray<INDEX> aiBots; // bots that are on their paths
+  static CStaticStackArray<INDEX> aiGroup; // bots with the same target
+  static CStaticStackArray<CBotPathPoint *> apbppSrc;
+  static CStaticStackArray<BOOL> abThrough;
+
+  aiBots.PopAll();
+
+  INDEX iBot;
+
+  for (iBot = 0; iBot < _aPlayerBots.Count(); iBot++) {
+    SBotProperties &props = _aPlayerBots[iBot].props;
+
+    if (props.m_pbppTarget == NULL) {
+      continue;
+    }
+
+    // Not on the path yet
+    if (props.m_pbppCurrent == NULL) {
+      props.m_tmChangePath = _pTimer->CurrentTick();
+      continue;
+    }
+
+    aiBots.Push() = iBot;
+  }
+
+  // Check paths of all bots going to the same target at once
+  while (aiBots.Count() > 0) {
+    CBotPathPoint *pbppTarget = _aPlayerBots[aiBots[0]].props.m_pbppTarget;
+
+    aiGroup.PopAll();
+    apbppSrc.PopAll();
+
+    INDEX ctLeft = 0;
+
+    for (INDEX i = 0; i < aiBots.Count(); i++) {
+      SBotProperties &props = _aPlayerBots[aiBots[i]].props;
+
+      // Keep the rest for later
+      if (props.m_pbppTarget != pbppTarget) {
+        aiBots[ctLeft++] = aiBots[i];
+        continue;
+      }
+
+      aiGroup.Push() = aiBots[i];
+      apbppSrc.Push() = props.m_pbppCurrent;
+    }
+
+    if (ctLeft > 0) {
+      aiBots.PopUntil(ctLeft - 1);
+    } else {
+      aiBots.PopAll();
+    }
+
+    const INDEX ctGroup = aiGroup.Count();
+    abThrough.PopAll();
+    abThrough.Push(ctGroup);
+
+    // Shortest path to the target leads through some changed point (it's been closed or has just opened)
+    _pNavmesh->RoutesThrough(pbppTarget, &apbppSrc[0], &abThrough[0], ctGroup, apbppChanged, ctChanged);
+
+    for (INDEX iGroup = 0; iGroup < ctGroup; iGroup++) {
+      if (abThrough[iGroup]) {
+        _aPlayerBots[aiGroup[iGroup]].props.m_tmChangePath = _pTimer->CurrentTick();
+      }
+    }
+  }
+};
+
 // [Cecil] 2021-06-12: Initialized bot mod
 static BOOL _bBotModInit = FALSE;
 
@@ -61,6 +133,10 @@ void CECIL_InitBotMod(void) {
 
   // [Cecil] 2021-06-12: Create Bot NavMesh
   _pNavmesh = new CBotNavmesh();
+  _pNavmesh->AddLockListener(&BotLockChanged, NULL);
+
+  // [Cecil] 2026-10-19: Compile weapon tables
+  CECIL_CompileWeaponTables();
 
   // [Cecil] 2021-06-11: Apply networking patch
   extern void CECIL_ApplyNetworkPatches(void);
@@ -84,6 +160,9 @@ void CECIL_InitBotMod(void) {
 
 // [Cecil] 2021-06-13: End the bot mod
 void CECIL_EndBotMod(void) {
+  // [Cecil] 2026-10-19: Stop loading the NavMesh
+  _nlNavmesh.Clear();
+
   // [Cecil] 2021-06-12: Destroy Bot NavMesh
   if (_pNavmesh != NULL) {
     delete _pNavmesh;
@@ -101,8 +180,10 @@ void CECIL_BotGameStart(CSessionProperties &sp) {
   penNew->Initialize();
 
   // [Cecil] 2021-06-13: Load NavMesh for a map
+  // [Cecil] 2026-10-19: Bots move directly towards their targets until it's read in the background
   try {
-    _pNavmesh->LoadNavmesh(wo);
+    _pNavmesh->bnm_pwoWorld = &wo;
+    _nlNavmesh.Start_t(wo);
 
   } catch (char *strError) {
     CPrintF("Cannot load NavMesh for the map: %s\n", strError);
@@ -117,277 +198,521 @@ void CECIL_BotGameStart(CSessionProperties &sp) {
 
 // [Cecil] 2021-06-12: Bot game cleanup
 void CECIL_BotGameCleanup(void) {
+  // [Cecil] 2026-10-19: Stop loading the NavMesh
+  _nlNavmesh.Clear();
+
   // [Cecil] 2018-10-23: Clear the NavMesh
   _pNavmesh->ClearNavmesh();
 
   // [Cecil] 2021-06-12: Clear bot list
   _aPlayerBots.Clear();
+
+  // [Cecil] 2026-10-19: Forget about bots that haven't been added yet
+  CECIL_ClearBotQueue();
 };
 
-// [Cecil] Render extras on top of the world
-void CECIL_WorldOverlayRender(CPlayer *penOwner, CEntity *penViewer, CAnyProjection3D &apr, CDrawPort *pdp) {
-  // not a server
-  if (!_pNetwork->IsServer() && !_pNetwork->IsPlayingDemo()) {
+// [Cecil] 2026-10-19: Navmesh overlay cache
+
+// Size of one cell of the point grid
+#define OVERLAY_CELL_SIZE 32.0f
+
+// Types of static overlay lines
+enum EOverlayLine {
+  OVL_POLYGON,    // polygon edge
+  OVL_CONNECTION, // connection to another point
+  OVL_NEXT,       // connection to the next important point
+};
+
+// Static line of some point
+struct SOverlayLine {
+  FLOAT3D vPos0;
+  FLOAT3D vPos1;
+  COLOR col; // color without alpha
+  FLOAT fAlpha; // multiplier of point's opacity
+  INDEX iType;
+};
+
+// Point with its lines and bounding sphere
+struct SOverlayPoint {
+  CBotPathPoint *pbpp;
+  INDEX iFirstLine;
+  INDEX ctLines;
+  FLOAT3D vCenter;
+  FLOAT fRadius;
+};
+
+// Cell of the point grid
+struct SOverlayCell {
+  INDEX iFirstPoint;
+  INDEX ctPoints;
+  FLOAT3D vCenter;
+  FLOAT fRadius;
+};
+
+// Point that passed culling
+struct SVisiblePoint {
+  SOverlayPoint *pop;
+  FLOAT fDist;
+  UBYTE ubAlpha;
+  FLOAT3D vOnScreen;
+};
+
+static CBotNavmesh *_pOverlayNavmesh = NULL;
+static ULONG _ulOverlayRevision = 0;
+
+static CStaticStackArray<SOverlayLine> _aOverlayLines;
+static CStaticStackArray<SOverlayPoint> _aOverlayPoints;
+static CStaticStackArray<SOverlayCell> _aOverlayCells;
+static CDynamicContainer<CBotPathPoint> _cOverlayEntityPoints; // points with important or lock entities
+
+static CStaticStackArray<SVisiblePoint> _aVisiblePoints;
+static CStaticStackArray<SVisiblePoint *> _apLabels;
+
+// Point with a grid cell
+struct SOverlayCellPoint {
+  INDEX aiCell[3];
+  CBotPathPoint *pbpp;
+};
+
+static int qsort_CompareCellPoints(const void *pv0, const void *pv1) {
+  const SOverlayCellPoint &cp0 = *(const SOverlayCellPoint *)pv0;
+  const SOverlayCellPoint &cp1 = *(const SOverlayCellPoint *)pv1;
+
+  for (INDEX i = 0; i < 3; i++) {
+    if (cp0.aiCell[i] < cp1.aiCell[i]) return -1;
+    if (cp0.aiCell[i] > cp1.aiCell[i]) return +1;
+  }
+  return 0;
+};
+
+static int qsort_CompareVisibleDist(const void *pv0, const void *pv1) {
+  const SVisiblePoint &vp0 = **(const SVisiblePoint **)pv0;
+  const SVisiblePoint &vp1 = **(const SVisiblePoint **)pv1;
+
+  if (vp0.fDist < vp1.fDist) return -1;
+  if (vp0.fDist > vp1.fDist) return +1;
+  return 0;
+};
+
+// Add static line to the last point
+static void AddOverlayLine(FLOATaabbox3D &boxPoint, const FLOAT3D &vPos0, const FLOAT3D &vPos1, COLOR col, FLOAT fAlpha, INDEX iType) {
+  SOverlayLine &ol = _aOverlayLines.Push();
+  ol.vPos0 = vPos0;
+  ol.vPos1 = vPos1;
+  ol.col = col;
+  ol.fAlpha = fAlpha;
+  ol.iType = iType;
+
+  boxPoint |= vPos0;
+  boxPoint |= vPos1;
+};
+
+// Rebuild the cache after the navmesh has been changed
+static void UpdateNavmeshOverlay(void) {
+  if (_pOverlayNavmesh == _pNavmesh && _ulOverlayRevision == _pNavmesh->bnm_ulRevision) {
     return;
   }
 
-  CPerspectiveProjection3D &prProjection = *(CPerspectiveProjection3D *)(CProjection3D *)apr;
-  prProjection.Prepare();
+  _pOverlayNavmesh = _pNavmesh;
+  _ulOverlayRevision = _pNavmesh->bnm_ulRevision;
 
-  pdp->SetFont(_pfdConsoleFont);
-  pdp->SetTextScaling(1.0f);
+  _aOverlayLines.PopAll();
+  _aOverlayPoints.PopAll();
+  _aOverlayCells.PopAll();
+  _cOverlayEntityPoints.Clear();
 
-  // NavMesh rendering
-  if (MOD_iRenderNavMesh > 0) {
-    if (_pNavmesh->bnm_aPoints.Count() > 0)
-    {
-      const INDEX iSelected = MOD_iNavMeshPoint;
-      const BOOL bConnections = (MOD_iRenderNavMesh > 1);
-      const BOOL bIDs = (MOD_iRenderNavMesh > 2);
-      const BOOL bFlags = (MOD_iRenderNavMesh > 3);
-
-      const CBotPathPoint *pbppClosest = NULL;
-
-      // Bots don't need to select points
-      if (!IsDerivedFromDllClass(penOwner, CPlayerBot_DLLClass)) {
-        pbppClosest = NearestNavMeshPointPos(penOwner, penOwner->GetPlayerWeapons()->m_vRayHit);
+  const INDEX ctPoints = _pNavmesh->bnm_aPoints.Count();
+  if (ctPoints <= 0) return;
+
+  // Sort points by grid cells
+  CStaticArray<SOverlayCellPoint> aCellPoints;
+  aCellPoints.New(ctPoints);
+
+  INDEX iPoint;
+
+  for (iPoint = 0; iPoint < ctPoints; iPoint++) {
+    SOverlayCellPoint &cp = aCellPoints[iPoint];
+    cp.pbpp = _pNavmesh->bnm_aPoints.Pointer(iPoint);
+
+    for (INDEX i = 0; i < 3; i++) {
+      cp.aiCell[i] = (INDEX)floorf(cp.pbpp->bpp_vPos(i + 1) / OVERLAY_CELL_SIZE);
+    }
+  }
+
+  qsort(&aCellPoints[0], ctPoints, sizeof(SOverlayCellPoint), qsort_CompareCellPoints);
+
+  FLOATaabbox3D boxCell;
+
+  for (iPoint = 0; iPoint < ctPoints; iPoint++) {
+    const SOverlayCellPoint &cp = aCellPoints[iPoint];
+    CBotPathPoint *pbpp = cp.pbpp;
+
+    // Start a new cell
+    if (iPoint == 0 || qsort_CompareCellPoints(&aCellPoints[iPoint - 1], &cp) != 0) {
+      SOverlayCell &oc = _aOverlayCells.Push();
+      oc.iFirstPoint = iPoint;
+      oc.ctPoints = 0;
+      boxCell = FLOATaabbox3D();
+    }
+
+    SOverlayPoint &op = _aOverlayPoints.Push();
+    op.pbpp = pbpp;
+    op.iFirstLine = _aOverlayLines.Count();
+
+    // Point itself with its range
+    FLOATaabbox3D boxPoint(pbpp->bpp_vPos, ClampDn(pbpp->bpp_fRange, 0.5f));
+
+    // Polygon edges
+    if (pbpp->bpp_bppoPolygon != NULL) {
+      CBrushPolygon &bpo = *pbpp->bpp_bppoPolygon->bppo_bpoPolygon;
+      const COLOR colEdge = HSVToColor((pbpp->bpp_iIndex * 160) % 256, 255, 255);
+
+      FOREACHINSTATICARRAY(bpo.bpo_abpePolygonEdges, CBrushPolygonEdge, itbpe) {
+        // Get edge vertices (edge direction is irrelevant here!)
+        const FLOAT3D &vVertex0 = itbpe->bpe_pbedEdge->bed_pbvxVertex0->bvx_vAbsolute;
+        const FLOAT3D &vVertex1 = itbpe->bpe_pbedEdge->bed_pbvxVertex1->bvx_vAbsolute;
+
+        AddOverlayLine(boxPoint, vVertex0, vVertex1, colEdge, 0.5f, OVL_POLYGON);
       }
+    }
 
-      for (INDEX iPoint = 0; iPoint < _pNavmesh->bnm_aPoints.Count(); iPoint++) {
-        CBotPathPoint *pbpp = _pNavmesh->bnm_aPoints.Pointer(iPoint);
+    // Connections
+    {FOREACHINDYNAMICCONTAINER(pbpp->bpp_cbppPoints, CBotPathPoint, itbppT) {
+      AddOverlayLine(boxPoint, pbpp->bpp_vPos, itbppT->bpp_vPos, C_ORANGE, 0.5f, OVL_CONNECTION);
+    }}
 
-        const INDEX iPointID = pbpp->bpp_iIndex;
-        const BOOL bSelectedPoint = (iSelected == iPointID);
+    // Next important point
+    if (pbpp->bpp_pbppNext != NULL) {
+      AddOverlayLine(boxPoint, pbpp->bpp_vPos, pbpp->bpp_pbppNext->bpp_vPos, 0x0000FF00, 1.0f, OVL_NEXT);
+    }
 
-        FLOAT3D vPointOnScreen;
-        FLOAT3D vPoint1 = pbpp->bpp_vPos;
-        prProjection.ProjectCoordinate(pbpp->bpp_vPos, vPointOnScreen);
+    // Lines to entities are dynamic
+    if (pbpp->bpp_penImportant != NULL || pbpp->bpp_penLock != NULL) {
+      _cOverlayEntityPoints.Add(pbpp);
+    }
 
-        vPointOnScreen(2) = -vPointOnScreen(2) + pdp->GetHeight();
+    op.ctLines = _aOverlayLines.Count() - op.iFirstLine;
+    op.vCenter = boxPoint.Center();
+    op.fRadius = boxPoint.Size().Length() * 0.5f;
 
-        // Point opacity based on distance to the viewer
-        UBYTE ubPointAlpha = 0xFF;
+    SOverlayCell &oc = _aOverlayCells[_aOverlayCells.Count() - 1];
+    oc.ctPoints++;
 
-        if (MOD_fNavMeshRenderRange > 0.0f) {
-          FLOAT fViewDist = (penViewer->GetPlacement().pl_PositionVector - vPoint1).Length();
-          FLOAT fPointAlpha = 1.0f - Clamp((fViewDist - MOD_fNavMeshRenderRange) / MOD_fNavMeshRenderRange, 0.0f, 1.0f);
+    boxCell |= boxPoint;
+    oc.vCenter = boxCell.Center();
+    oc.fRadius = boxCell.Size().Length() * 0.5f;
+  }
+};
 
-          ubPointAlpha = NormFloatToByte(fPointAlpha);
-        }
+// Check if some sphere can be seen
+static BOOL OverlaySphereVisible(CProjection3D &pr, const FLOAT3D &vViewer, FLOAT fMaxDist, const FLOAT3D &vCenter, FLOAT fRadius) {
+  // Too far
+  if (fMaxDist > 0.0f && (vCenter - vViewer).Length() - fRadius > fMaxDist) {
+    return FALSE;
+  }
 
-        if (ubPointAlpha <= 2) {
-          continue;
-        }
+  // Outside the view
+  FLOAT3D vView;
+  pr.PreClip(vCenter, vView);
 
-        // [Cecil] TEMP: Draw polygons
-        if (pbpp->bpp_bppoPolygon != NULL) {
-          CBrushPolygon &bpo = *pbpp->bpp_bppoPolygon->bppo_bpoPolygon;
+  return (pr.TestSphereToFrustum(vView, fRadius) >= 0);
+};
 
-          const INDEX ctEdges = bpo.bpo_abpePolygonEdges.Count();
-          INDEX iEdge = 0;
+// Render lines to entities of some point
+static void RenderOverlayEntityLines(CProjection3D &pr, CDrawPort *pdp, CBotPathPoint *pbpp, UBYTE ubPointAlpha) {
+  const FLOAT3D &vPoint1 = pbpp->bpp_vPos;
 
-          FOREACHINSTATICARRAY(bpo.bpo_abpePolygonEdges, CBrushPolygonEdge, itbpe) {
-            // Get edge vertices (edge direction is irrelevant here!)
-            const FLOAT3D &vVertex0 = itbpe->bpe_pbedEdge->bed_pbvxVertex0->bvx_vAbsolute;
-            const FLOAT3D &vVertex1 = itbpe->bpe_pbedEdge->bed_pbvxVertex1->bvx_vAbsolute;
+  // connect with important entity
+  if (ASSERT_ENTITY(pbpp->bpp_penImportant)) {
+    CEntity *penImportant = pbpp->bpp_penImportant;
+    FLOAT3D vEntity = penImportant->GetLerpedPlacement().pl_PositionVector;
 
-            FLOAT3D vOnScreen1, vOnScreen2;
+    FLOAT3D vOnScreen1, vEntityOnScreen;
 
-            if (ProjectLine(&prProjection, vVertex0, vVertex1, vOnScreen1, vOnScreen2)) {
-              pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vOnScreen2(1), vOnScreen2(2),
-                            //HSVToColor(INDEX(FLOAT(iEdge * 2 + 1) / ctEdges * 255) % 256, 255, 255)
-                            HSVToColor((iPointID * 160) % 256, 255, 255) | UBYTE(ubPointAlpha * 0.5f));
-            }
+    // from point to entity
+    if (ProjectLine(&pr, vPoint1, vEntity, vOnScreen1, vEntityOnScreen)) {
+      pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vEntityOnScreen(1), vEntityOnScreen(2), 0x00FF0000 | ubPointAlpha);
+    }
+  }
 
-            iEdge++;
-          }
-        }
+  // connect with lock entity
+  if (ASSERT_ENTITY(pbpp->bpp_penLock)) {
+    CEntity *penLock = pbpp->bpp_penLock;
+    FLOAT3D vEntity = penLock->GetLerpedPlacement().pl_PositionVector;
+    ANGLE3D aEntity = penLock->GetLerpedPlacement().pl_OrientationAngle;
 
-        // Highlight closest point for selection
-        const BOOL bClosestPoint = (pbppClosest == pbpp);
+    FLOAT3D vOrigin = pbpp->bpp_plLockOrigin.pl_PositionVector;
+    ANGLE3D aOrigin = pbpp->bpp_plLockOrigin.pl_OrientationAngle;
 
-        // Render connections only if it should be for all points, if there's no current point or it is THE current point
-        const BOOL bSelectedConnections = (!MOD_bOnlyCurrentConnections || iSelected < 0 || bSelectedPoint);
+    FLOAT3D vOnScreen1, vEntityOnScreen, vOriginOnScreen;
 
-        // Connections
-        if (bConnections && bSelectedConnections) {
-          {FOREACHINDYNAMICCONTAINER(pbpp->bpp_cbppPoints, CBotPathPoint, itbppT) {
-            CBotPathPoint *pbppT = itbppT;
+    // from point to entity
+    if (ProjectLine(&pr, vPoint1, vEntity, vOnScreen1, vEntityOnScreen)) {
+      pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vEntityOnScreen(1), vEntityOnScreen(2), 0xFFFF7F00 | UBYTE(ubPointAlpha * 0.5f));
+    }
 
-            FLOAT3D vOnScreen1, vOnScreen2;
-            FLOAT3D vPoint2 = pbppT->bpp_vPos;
+    // from entity to origin position
+    if ((vEntity - vOrigin).Length() > 0.01f && ProjectLine(&pr, vEntity, vOrigin, vEntityOnScreen, vOriginOnScreen)) {
+      pdp->DrawLine(vEntityOnScreen(1), vEntityOnScreen(2), vOriginOnScreen(1), vOriginOnScreen(2), 0x7FFF7F00 | ubPointAlpha);
+    }
 
-            if (ProjectLine(&prProjection, vPoint1, vPoint2, vOnScreen1, vOnScreen2)) {
-              pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vOnScreen2(1), vOnScreen2(2), C_ORANGE | UBYTE(ubPointAlpha * 0.5f));
-            }
-          }}
+    // different origin angle
+    if ((aEntity - aOrigin).Length() > 0.1f) {
+      FLOATmatrix3D mOrigin;
+      MakeRotationMatrixFast(mOrigin, aOrigin);
 
-          // connect with important entity
-          if (ASSERT_ENTITY(pbpp->bpp_penImportant)) {
-            CEntity *penImportant = pbpp->bpp_penImportant;
-            FLOAT3D vEntity = penImportant->GetLerpedPlacement().pl_PositionVector;
+      // origin angle
+      FLOAT3D vAngle = FLOAT3D(0.0f, 0.0f, -2.0f) * mOrigin;
 
-            FLOAT3D vOnScreen1, vEntityOnScreen;
+      if (ProjectLine(&pr, vOrigin, vOrigin + vAngle, vEntityOnScreen, vOriginOnScreen)) {
+        pdp->DrawLine(vEntityOnScreen(1), vEntityOnScreen(2), vOriginOnScreen(1), vOriginOnScreen(2), 0x7F7FFF00 | ubPointAlpha);
+      }
 
-            // from point to entity
-            if (ProjectLine(&prProjection, vPoint1, vEntity, vOnScreen1, vEntityOnScreen)) {
-              pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vEntityOnScreen(1), vEntityOnScreen(2), 0x00FF0000 | ubPointAlpha);
-            }
-          }
+      // derived angle
+      vAngle = FLOAT3D(0.0f, 0.0f, -2.0f) * penLock->GetRotationMatrix();
 
-          // connect with lock entity
-          if (ASSERT_ENTITY(pbpp->bpp_penLock)) {
-            CEntity *penLock = pbpp->bpp_penLock;
-            FLOAT3D vEntity = penLock->GetLerpedPlacement().pl_PositionVector;
-            ANGLE3D aEntity = penLock->GetLerpedPlacement().pl_OrientationAngle;
+      if (ProjectLine(&pr, vEntity, vEntity + vAngle, vEntityOnScreen, vOriginOnScreen)) {
+        pdp->DrawLine(vEntityOnScreen(1), vEntityOnScreen(2), vOriginOnScreen(1), vOriginOnScreen(2), 0xFF7F7F00 | ubPointAlpha);
+      }
+    }
+  }
+};
 
-            FLOAT3D vOrigin = pbpp->bpp_plLockOrigin.pl_PositionVector;
-            ANGLE3D aOrigin = pbpp->bpp_plLockOrigin.pl_OrientationAngle;
+// Point opacity based on distance to the viewer
+static UBYTE OverlayPointAlpha(FLOAT fViewDist) {
+  if (MOD_fNavMeshRenderRange <= 0.0f) {
+    return 0xFF;
+  }
 
-            FLOAT3D vOnScreen1, vEntityOnScreen, vOriginOnScreen;
+  FLOAT fPointAlpha = 1.0f - Clamp((fViewDist - MOD_fNavMeshRenderRange) / MOD_fNavMeshRenderRange, 0.0f, 1.0f);
+  return NormFloatToByte(fPointAlpha);
+};
 
-            // from point to entity
-            if (ProjectLine(&prProjection, vPoint1, vEntity, vOnScreen1, vEntityOnScreen)) {
-              pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vEntityOnScreen(1), vEntityOnScreen(2), 0xFFFF7F00 | UBYTE(ubPointAlpha * 0.5f));
-            }
+// Render the navmesh
+static void RenderNavmeshOverlay(CPlayer *penOwner, CEntity *penViewer, CAnyProjection3D &apr, CDrawPort *pdp) {
+  CPerspectiveProjection3D &prProjection = *(CPerspectiveProjection3D *)(CProjection3D *)apr;
 
-            // from entity to origin position
-            if ((vEntity - vOrigin).Length() > 0.01f && ProjectLine(&prProjection, vEntity, vOrigin, vEntityOnScreen, vOriginOnScreen)) {
-              pdp->DrawLine(vEntityOnScreen(1), vEntityOnScreen(2), vOriginOnScreen(1), vOriginOnScreen(2), 0x7FFF7F00 | ubPointAlpha);
-            }
+  const INDEX iSelected = MOD_iNavMeshPoint;
+  const BOOL bConnections = (MOD_iRenderNavMesh > 1);
+  const BOOL bIDs = (MOD_iRenderNavMesh > 2);
+  const BOOL bFlags = (MOD_iRenderNavMesh > 3);
 
-            // different origin angle
-            if ((aEntity - aOrigin).Length() > 0.1f) {
-              FLOATmatrix3D mOrigin;
-              MakeRotationMatrixFast(mOrigin, aOrigin);
+  const CBotPathPoint *pbppClosest = NULL;
 
-              // origin angle
-              FLOAT3D vAngle = FLOAT3D(0.0f, 0.0f, -2.0f) * mOrigin;
+  // Bots don't need to select points
+  if (!IsDerivedFromDllClass(penOwner, CPlayerBot_DLLClass)) {
+    pbppClosest = NearestNavMeshPointPos(penOwner, penOwner->GetPlayerWeapons()->m_vRayHit);
+  }
 
-              if (ProjectLine(&prProjection, vOrigin, vOrigin + vAngle, vEntityOnScreen, vOriginOnScreen)) {
-                pdp->DrawLine(vEntityOnScreen(1), vEntityOnScreen(2), vOriginOnScreen(1), vOriginOnScreen(2), 0x7F7FFF00 | ubPointAlpha);
-              }
+  UpdateNavmeshOverlay();
 
-              // derived angle
-              vAngle = FLOAT3D(0.0f, 0.0f, -2.0f) * penLock->GetRotationMatrix();
+  const FLOAT3D vViewer = penViewer->GetPlacement().pl_PositionVector;
 
-              if (ProjectLine(&prProjection, vEntity, vEntity + vAngle, vEntityOnScreen, vOriginOnScreen)) {
-                pdp->DrawLine(vEntityOnScreen(1), vEntityOnScreen(2), vOriginOnScreen(1), vOriginOnScreen(2), 0xFF7F7F00 | ubPointAlpha);
-              }
-            }
-          }
+  // Points are fully transparent at twice the range
+  const FLOAT fMaxDist = MOD_fNavMeshRenderRange * 2.0f;
 
-          // connect with next important point
-          if (pbpp->bpp_pbppNext != NULL) {
-            FLOAT3D vOnScreen1, vNextPointOnScreen;
+  // Gather visible points
+  _aVisiblePoints.PopAll();
 
-            if (ProjectLine(&prProjection, vPoint1, pbpp->bpp_pbppNext->bpp_vPos, vOnScreen1, vNextPointOnScreen)) {
-              pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vNextPointOnScreen(1), vNextPointOnScreen(2), 0x0000FF00 | ubPointAlpha);
-            }
-          }
-        }
+  for (INDEX iCell = 0; iCell < _aOverlayCells.Count(); iCell++) {
+    const SOverlayCell &oc = _aOverlayCells[iCell];
 
-        // Draw the point itself
-        if (vPointOnScreen(3) < 0.0f)
-        {
-          // Selected point
-          if (bSelectedPoint) {
-            pdp->DrawPoint(vPointOnScreen(1), vPointOnScreen(2), 0xFF000000 | ubPointAlpha, 10);
-
-          // Point for selection
-          } else if (bClosestPoint) {
-            pdp->DrawPoint(vPointOnScreen(1), vPointOnScreen(2), 0x00990000 | ubPointAlpha, 10);
-
-          // Normal point
-          } else {
-            pdp->DrawPoint(vPointOnScreen(1), vPointOnScreen(2), 0xFFFF0000 | ubPointAlpha, 5);
-          }
-
-          // Point IDs
-          if (bIDs) {
-            CTString strPoint;
-            strPoint.PrintF("ID: %d", iPointID);
-
-            // Point flags
-            if (bFlags) {
-              #define POINT_DESC(_Type) strPoint += ((pbpp->bpp_ulFlags & PPF_##_Type) ? "\n " #_Type : "")
-
-              POINT_DESC(WALK);
-              POINT_DESC(JUMP);
-              POINT_DESC(CROUCH);
-              POINT_DESC(OVERRIDE);
-              POINT_DESC(UNREACHABLE);
-              POINT_DESC(TELEPORT);
-              POINT_DESC(IMPORTANT);
-
-              #undef POINT_DESC
-            }
-
-            pdp->PutTextC(strPoint, vPointOnScreen(1), vPointOnScreen(2) + 16, 0xFFFFFF00 | ubPointAlpha);
-          }
-        }
+    if (!OverlaySphereVisible(prProjection, vViewer, fMaxDist, oc.vCenter, oc.fRadius)) {
+      continue;
+    }
+
+    for (INDEX iPoint = oc.iFirstPoint; iPoint < oc.iFirstPoint + oc.ctPoints; iPoint++) {
+      SOverlayPoint &op = _aOverlayPoints[iPoint];
+
+      if (!OverlaySphereVisible(prProjection, vViewer, fMaxDist, op.vCenter, op.fRadius)) {
+        continue;
+      }
+
+      const FLOAT fDist = (vViewer - op.pbpp->bpp_vPos).Length();
+      const UBYTE ubAlpha = OverlayPointAlpha(fDist);
+
+      if (ubAlpha <= 2) {
+        continue;
       }
 
-      // Prepare projection
-      CPerspectiveProjection3D &ppr = (CPerspectiveProjection3D &)*(CProjection3D *)apr;
-      ppr.Prepare();
+      SVisiblePoint &vp = _aVisiblePoints.Push();
+      vp.pop = &op;
+      vp.fDist = fDist;
+      vp.ubAlpha = ubAlpha;
+    }
+  }
 
-      ppr.FrontClipDistanceL() = 0.1f;
-      ppr.DepthBufferNearL() = 0.0f;
-      ppr.DepthBufferFarL() = 0.1f;
+  const INDEX ctVisible = _aVisiblePoints.Count();
+  INDEX iVisible;
 
-      CAnyProjection3D aprWallhack;
-      aprWallhack = ppr;
+  // Lines and points
+  _apLabels.PopAll();
 
-      BeginModelRenderingView(aprWallhack, pdp);
+  for (iVisible = 0; iVisible < ctVisible; iVisible++) {
+    SVisiblePoint &vp = _aVisiblePoints[iVisible];
+    CBotPathPoint *pbpp = vp.pop->pbpp;
 
-      // Render point ranges
-      for (INDEX iPointRange = 0; iPointRange < _pNavmesh->bnm_aPoints.Count(); iPointRange++) {
-        CBotPathPoint *pbpp = _pNavmesh->bnm_aPoints.Pointer(iPointRange);
-        FLOAT3D vPoint = pbpp->bpp_vPos;
-        FLOAT3D(pbpp->bpp_fRange, pbpp->bpp_fRange, pbpp->bpp_fRange);
+    const BOOL bSelectedPoint = (iSelected == pbpp->bpp_iIndex);
 
-        // Point opacity based on distance to the viewer
-        UBYTE ubPointAlpha = 0xFF;
+    // Render connections only if it should be for all points, if there's no current point or it is THE current point
+    const BOOL bSelectedConnections = (bConnections && (!MOD_bOnlyCurrentConnections || iSelected < 0 || bSelectedPoint));
 
-        if (MOD_fNavMeshRenderRange > 0.0f) {
-          FLOAT fViewDist = (penViewer->GetPlacement().pl_PositionVector - vPoint).Length();
-          FLOAT fPointAlpha = 1.0f - Clamp((fViewDist - MOD_fNavMeshRenderRange) / MOD_fNavMeshRenderRange, 0.0f, 1.0f);
+    for (INDEX iLine = vp.pop->iFirstLine; iLine < vp.pop->iFirstLine + vp.pop->ctLines; iLine++) {
+      const SOverlayLine &ol = _aOverlayLines[iLine];
 
-          ubPointAlpha = NormFloatToByte(fPointAlpha);
-        }
+      if (ol.iType != OVL_POLYGON && !bSelectedConnections) {
+        continue;
+      }
 
-        if (ubPointAlpha <= 2) {
-          continue;
-        }
+      FLOAT3D vOnScreen1, vOnScreen2;
 
-        // Pick range model
-        const INDEX iRangeModel = Clamp(MOD_iNavMeshRangeModel, (INDEX)0, (INDEX)2);
-        CModelObject &moRange = _amoRange[iRangeModel];
+      if (ProjectLine(&prProjection, ol.vPos0, ol.vPos1, vOnScreen1, vOnScreen2)) {
+        pdp->DrawLine(vOnScreen1(1), vOnScreen1(2), vOnScreen2(1), vOnScreen2(2), ol.col | UBYTE(vp.ubAlpha * ol.fAlpha));
+      }
+    }
 
-        // Render range model
-        CRenderModel rmMain;
-        rmMain.SetObjectPlacement(CPlacement3D(vPoint, ANGLE3D(0.0f, 0.0f, 0.0f)));
-        rmMain.rm_colLight = C_BLACK;  
-        rmMain.rm_colAmbient = C_WHITE;
-        rmMain.rm_colBlend = 0x00FFFF00 | ubPointAlpha;
-        rmMain.rm_vLightDirection = FLOAT3D(1.0f, 1.0f, 1.0f);
+    prProjection.ProjectCoordinate(pbpp->bpp_vPos, vp.vOnScreen);
+    vp.vOnScreen(2) = -vp.vOnScreen(2) + pdp->GetHeight();
 
-        moRange.SetupModelRendering(rmMain);
+    // Draw the point itself
+    if (vp.vOnScreen(3) < 0.0f) {
+      // Selected point
+      if (bSelectedPoint) {
+        pdp->DrawPoint(vp.vOnScreen(1), vp.vOnScreen(2), 0xFF000000 | vp.ubAlpha, 10);
 
-        // Multiply model size
-        rmMain.rm_vStretch(1) *= pbpp->bpp_fRange;
-        rmMain.rm_vStretch(3) *= pbpp->bpp_fRange;
+      // Point for selection
+      } else if (pbppClosest == pbpp) {
+        pdp->DrawPoint(vp.vOnScreen(1), vp.vOnScreen(2), 0x00990000 | vp.ubAlpha, 10);
 
-        // Resize vertically only if sphere model
-        if (iRangeModel == 2) {
-          rmMain.rm_vStretch(2) *= pbpp->bpp_fRange;
-        }
+      // Normal point
+      } else {
+        pdp->DrawPoint(vp.vOnScreen(1), vp.vOnScreen(2), 0xFFFF0000 | vp.ubAlpha, 5);
+      }
+
+      if (bIDs) {
+        _apLabels.Push() = &vp;
+      }
+    }
+  }
+
+  // Lines to entities
+  if (bConnections) {
+    FOREACHINDYNAMICCONTAINER(_cOverlayEntityPoints, CBotPathPoint, itbpp) {
+      CBotPathPoint *pbpp = itbpp;
+
+      if (MOD_bOnlyCurrentConnections && iSelected >= 0 && iSelected != pbpp->bpp_iIndex) {
+        continue;
+      }
+
+      const UBYTE ubAlpha = OverlayPointAlpha((vViewer - pbpp->bpp_vPos).Length());
+
+      if (ubAlpha > 2) {
+        RenderOverlayEntityLines(prProjection, pdp, pbpp, ubAlpha);
+      }
+    }
+  }
+
+  // Point IDs of the nearest points
+  const INDEX ctLabels = Min(_apLabels.Count(), ClampDn(MOD_iNavMeshLabels, (INDEX)0));
+
+  if (ctLabels > 0) {
+    qsort(&_apLabels[0], _apLabels.Count(), sizeof(SVisiblePoint *), qsort_CompareVisibleDist);
+
+    for (INDEX iLabel = 0; iLabel < ctLabels; iLabel++) {
+      const SVisiblePoint &vp = *_apLabels[iLabel];
+      CBotPathPoint *pbpp = vp.pop->pbpp;
 
-        moRange.RenderModel(rmMain);
+      CTString strPoint;
+      strPoint.PrintF("ID: %d", pbpp->bpp_iIndex);
+
+      // Point flags
+      if (bFlags) {
+        #define POINT_DESC(_Type) strPoint += ((pbpp->bpp_ulFlags & PPF_##_Type) ? "\n " #_Type : "")
+
+        POINT_DESC(WALK);
+        POINT_DESC(JUMP);
+        POINT_DESC(CROUCH);
+        POINT_DESC(OVERRIDE);
+        POINT_DESC(UNREACHABLE);
+        POINT_DESC(TELEPORT);
+        POINT_DESC(IMPORTANT);
+
+        #undef POINT_DESC
       }
 
-      EndModelRenderingView();
+      pdp->PutTextC(strPoint, vp.vOnScreen(1), vp.vOnScreen(2) + 16, 0xFFFFFF00 | vp.ubAlpha);
+    }
+  }
+
+  // Prepare projection
+  CPerspectiveProjection3D &ppr = (CPerspectiveProjection3D &)*(CProjection3D *)apr;
+  ppr.Prepare();
+
+  ppr.FrontClipDistanceL() = 0.1f;
+  ppr.DepthBufferNearL() = 0.0f;
+  ppr.DepthBufferFarL() = 0.1f;
+
+  CAnyProjection3D aprWallhack;
+  aprWallhack = ppr;
+
+  BeginModelRenderingView(aprWallhack, pdp);
+
+  // Pick range model
+  const INDEX iRangeModel = Clamp(MOD_iNavMeshRangeModel, (INDEX)0, (INDEX)2);
+  CModelObject &moRange = _amoRange[iRangeModel];
+
+  // Render ranges of visible points
+  for (iVisible = 0; iVisible < ctVisible; iVisible++) {
+    const SVisiblePoint &vp = _aVisiblePoints[iVisible];
+    CBotPathPoint *pbpp = vp.pop->pbpp;
+
+    // Render range model
+    CRenderModel rmMain;
+    rmMain.SetObjectPlacement(CPlacement3D(pbpp->bpp_vPos, ANGLE3D(0.0f, 0.0f, 0.0f)));
+    rmMain.rm_colLight = C_BLACK;  
+    rmMain.rm_colAmbient = C_WHITE;
+    rmMain.rm_colBlend = 0x00FFFF00 | vp.ubAlpha;
+    rmMain.rm_vLightDirection = FLOAT3D(1.0f, 1.0f, 1.0f);
+
+    moRange.SetupModelRendering(rmMain);
+
+    // Multiply model size
+    rmMain.rm_vStretch(1) *= pbpp->bpp_fRange;
+    rmMain.rm_vStretch(3) *= pbpp->bpp_fRange;
+
+    // Resize vertically only if sphere model
+    if (iRangeModel == 2) {
+      rmMain.rm_vStretch(2) *= pbpp->bpp_fRange;
+    }
+
+    moRange.RenderModel(rmMain);
+  }
+
+  EndModelRenderingView();
+};
+
+// [Cecil] Render extras on top of the world
+void CECIL_WorldOverlayRender(CPlayer *penOwner, CEntity *penViewer, CAnyProjection3D &apr, CDrawPort *pdp) {
+  // [Cecil] 2026-10-19: Load resources of queued bots between game ticks
+  CECIL_PreloadBotQueue();
+
+  // not a server
+  if (!_pNetwork->IsServer() && !_pNetwork->IsPlayingDemo()) {
+    return;
+  }
+
+  CPerspectiveProjection3D &prProjection = *(CPerspectiveProjection3D *)(CProjection3D *)apr;
+  prProjection.Prepare();
+
+  pdp->SetFont(_pfdConsoleFont);
+  pdp->SetTextScaling(1.0f);
+
+  // NavMesh rendering
+  if (MOD_iRenderNavMesh > 0) {
+    _pfBotModProfile.StartTimer(CBotModProfile::PTI_NAVMESHRENDER); // [Cecil] 2026-10-19
+
+    if (_pNavmesh->bnm_aPoints.Count() > 0) {
+      RenderNavmeshOverlay(penOwner, penViewer, apr, pdp);
     }
 
     // [Cecil] 2019-06-04: Render bots' target points
@@ -420,6 +745,9 @@ void CECIL_WorldOverlayRender(CPlayer *penOwner, CEntity *penViewer, CAnyProject
         }
       }
     }
+
+    _pfBotModProfile.StopTimer(CBotModProfile::PTI_NAVMESHRENDER);
+    _pfBotModProfile.IncrementTimerAveragingCounter(CBotModProfile::PTI_NAVMESHRENDER);
   }
 
   // render entity IDs
@@ -472,11 +800,15 @@ void CECIL_HUDOverlayRender(CPlayer *penOwner, CEntity *penViewer, CAnyProjectio
     PIX pixY = 56 * fScaling;
     PIX pixThought = 18 * fScaling;
 
-    for (INDEX iThought = 0; iThought < 16; iThought++) {
+    const SBotThoughts &btThoughts = penBot->GetProps().m_btThoughts;
+    CTString strThought;
+
+    for (INDEX iThought = 0; iThought < btThoughts.ctThoughts; iThought++) {
       UBYTE ubAlpha = NormFloatToByte(1.0f - iThought / 50.0f);
-      COLOR colText = LerpColor(0xFFFFFF00, 0x7F7F7F00, iThought / 15.0f) | ubAlpha;
+      COLOR colText = LerpColor(0xFFFFFF00, 0x7F7F7F00, iThought / FLOAT(BOT_THOUGHTS - 1)) | ubAlpha;
 
-      pdp->PutText(penBot->GetProps().m_btThoughts.strThoughts[iThought], pixX, pixY + iThought * pixThought, colText);
+      btThoughts.Format(iThought, strThought);
+      pdp->PutText(strThought, pixX, pixY + iThought * pixThought, colText);
     }
 
     // Target point
@@ -25,6 +25,7 @@ extern FLOAT MOD_fNavMeshRenderRange;
 extern INDEX MOD_iNavMeshRangeModel;
 extern INDEX MOD_iNavMeshPoint;
 extern INDEX MOD_iNavMeshConnecting;
+extern INDEX MOD_iNavMeshLabels;
 
 // [Cecil] 2021-06-11: List of bots
 DECL_DLL extern CDynamicContainer<CPlayerBotController> _aPlayerBots;
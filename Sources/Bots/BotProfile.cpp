@@ -0,0 +1,37 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#include "StdH.h"
+#include "BotProfile.h"
+
+// [Cecil] 2026-10-19: Bot mod profile that's included in the game profiling report
+CBotModProfile _pfBotModProfile;
+
+// Constructor
+CBotModProfile::CBotModProfile(void) : CProfileForm("Bot mod", "frames", CBotModProfile::PCI_COUNT, CBotModProfile::PTI_COUNT)
+{
+  // Set names directly instead of using engine-only SETTIMERNAME() and SETCOUNTERNAME() macros
+  SetTimerName_internal(PTI_THINKING,       "BotThinking()",     "bot");
+  SetTimerName_internal(PTI_PERCEPTION,     "Perception",        "search");
+  SetTimerName_internal(PTI_PATHFINDING,    "FlowNextPoint()",   "path");
+  SetTimerName_internal(PTI_NAVMESHRENDER,  "Navmesh rendering", "");
+  SetTimerName_internal(PTI_SANDBOXPACKETS, "Sandbox actions",   "action");
+
+  SetCounterName_internal(PCI_RAYS,             "bot rays");
+  SetCounterName_internal(PCI_ASTAR_EXPANSIONS, "path point expansions");
+  SetCounterName_internal(PCI_ENTITIES_SCANNED, "entities scanned");
+  SetCounterName_internal(PCI_PIT_PROBES,       "live pit probes");
+  SetCounterName_internal(PCI_PIT_LEDGES,       "pit checks from ledges");
+};
@@ -0,0 +1,52 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#ifndef _CECILBOTS_BOTPROFILE_H
+#define _CECILBOTS_BOTPROFILE_H
+
+#include <Engine/Base/Profiling.h>
+
+// [Cecil] 2026-10-19: Profiling of the bot mod logic
+class DECL_DLL CBotModProfile : public CProfileForm {
+  public:
+    // Profiling timers
+    enum ProfileTimerIndex {
+      PTI_THINKING,       // bot thinking and weapon logic
+      PTI_PERCEPTION,     // searching for enemies and items
+      PTI_PATHFINDING,    // searching for paths on the navmesh
+      PTI_NAVMESHRENDER,  // navmesh overlay rendering
+      PTI_SANDBOXPACKETS, // handling of sandbox actions
+      PTI_COUNT
+    };
+
+    // Profiling counters
+    enum ProfileCounterIndex {
+      PCI_RAYS,              // rays cast by bots
+      PCI_ASTAR_EXPANSIONS,  // points expanded during path searching
+      PCI_ENTITIES_SCANNED,  // entities checked during perception
+      PCI_PIT_PROBES,        // live checks for bottomless pits
+      PCI_PIT_LEDGES,        // pit checks answered by NavMesh ledges
+      PCI_COUNT
+    };
+
+  public:
+    // Constructor
+    CBotModProfile(void);
+};
+
+// Bot mod profile that's included in the game profiling report
+DECL_DLL extern CBotModProfile _pfBotModProfile;
+
+#endif // _CECILBOTS_BOTPROFILE_H
@@ -24,24 +24,36 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #include "EntitiesMP/PlayerWeapons.h"
 
 // Add new bot thought
-void SBotProperties::Thought(const char *strFormat, ...) {
+void SBotProperties::Thought(EBotThought eType, INDEX iArg, FLOAT fArg1, FLOAT fArg2, const char *strArg) {
   // Don't bother
-  extern INDEX MOD_bBotThoughts;
-  if (!MOD_bBotThoughts) return;
+  if (!SBotThoughts::Enabled()) return;
 
-  va_list arg;
-  va_start(arg, strFormat);
+  SBotThought bt;
+  bt.bt_ubType = eType;
+  bt.bt_iArg = iArg;
+  bt.bt_afArgs[0] = fArg1;
+  bt.bt_afArgs[1] = fArg2;
+  bt.bt_strArg = strArg;
+  bt.bt_tmTick = _pTimer->CurrentTick();
 
-  CTString strNew;
-  strNew.VPrintF(strFormat, arg);
-
-  va_end(arg);
+  m_btThoughts.Push(bt);
+};
 
-  // Update the last thought if it's the same
-  if (m_btThoughts.strLast == strNew) {
-    m_btThoughts.SetLast(strNew);
-  } else {
-    m_btThoughts.Push(strNew);
+// [Cecil] 2026-10-19: Format thought text
+void SBotThought::Format(CTString &strText) const {
+  switch (bt_ubType) {
+    case BTH_GOINGFORITEM:     strText.PrintF("Going for ^c7f7fff%s", bt_strArg); break;
+    case BTH_ITEMNOTPICKABLE:  strText = "^c7f7fffItem is no longer pickable"; break;
+    case BTH_IMPORTANTPOINT:   strText.PrintF("New important point: ^caf3f3f%d", bt_iArg); break;
+    case BTH_REACHEDIMPORTANT: strText = "^caf3f3fReached important point"; break;
+    case BTH_NEXTIMPORTANT:    strText = "^c3f3fafNext important point"; break;
+    case BTH_CLOSESTPOINT:     strText.PrintF("Closest point ^c00ff00%d ^c00af00[%.1f, %.1f]", bt_iArg, bt_afArgs[0], bt_afArgs[1]); break;
+    case BTH_NEXTPOINT:        strText.PrintF("Next point ^c00ff00%d ^c00af00[%.1f, %.1f]", bt_iArg, bt_afArgs[0], bt_afArgs[1]); break;
+    case BTH_STAYINGATPOINT:   strText.PrintF("Staying at ^c00ff00%d ^c00af00[%.1f, %.1f]", bt_iArg, bt_afArgs[0], bt_afArgs[1]); break;
+    case BTH_BOTTOMLESSPIT:    strText.PrintF("Bottomless pit: %d", bt_iArg); break;
+    case BTH_STOPSHOOTING:     strText = "Stop shooting"; break;
+    case BTH_SHOOTFOR:         strText.PrintF("Shoot for %.2fs", bt_afArgs[0]); break;
+    default: strText = "";
   }
 };
 
@@ -257,14 +269,10 @@ void CPlayerBotController::BotWeapons(CPlayerAction &pa, SBotLogic &sbl) {
   // Select knife for faster speed if haven't seen the enemy in a while
   if (!IsCoopGame() && _pTimer->CurrentTick() - props.m_tmLastSawTarget > 2.0f)
   {
-    for (INDEX iWeapon = 0; iWeapon < CT_BOT_WEAPONS; iWeapon++) {
-      INDEX iType = aWeapons[iWeapon].bw_iType;
-
-      if (iType == WPN_DEFAULT_1) {
-        props.m_iBotWeapon = iWeapon;
-        sbl.iDesiredWeapon = WPN_DEFAULT_1;
-        break;
-      }
+    // [Cecil] 2026-10-19: Default weapon is found in advance
+    if (sbl.pbwtWeapons->bwt_iDefault != -1) {
+      props.m_iBotWeapon = sbl.pbwtWeapons->bwt_iDefault;
+      sbl.iDesiredWeapon = WPN_DEFAULT_1;
     }
     return;
   }
@@ -273,15 +281,16 @@ void CPlayerBotController::BotWeapons(CPlayerAction &pa, SBotLogic &sbl) {
   INDEX iSelect = WPN_NOTHING;
   FLOAT fLastDamage = 0.0f;
 
-  INDEX iWeaponType;
-  FLOAT fMin, fMax, fAccuracy;
+  // [Cecil] 2026-10-19: Go through weapons that can be used at this distance from best to worst
+  const SBotWeaponTable &bwt = *sbl.pbwtWeapons;
+  const INDEX iRange = bwt.Range(props.m_fTargetDist);
 
-  for (INDEX iWeapon = 0; iWeapon < CT_BOT_WEAPONS; iWeapon++) {
-    iWeaponType = aWeapons[iWeapon].bw_iType;
+  // Ratings need to be compared close to where they change their order
+  const BOOL bRate = bwt.NearBreak(props.m_fTargetDist, iRange);
 
-    fMin = aWeapons[iWeapon].bw_fMinDistance;
-    fMax = aWeapons[iWeapon].bw_fMaxDistance;
-    fAccuracy = aWeapons[iWeapon].bw_fAccuracy;
+  for (INDEX iCandidate = bwt.bwt_aiFirst[iRange]; iCandidate < bwt.bwt_aiFirst[iRange + 1]; iCandidate++) {
+    const INDEX iWeapon = bwt.bwt_aiCandidates[iCandidate];
+    const INDEX iWeaponType = aWeapons[iWeapon].bw_iType;
 
     // Skip unexistent weapons
     if (!WPN_EXISTS(penWeapons, iWeaponType)) {
@@ -293,24 +302,25 @@ void CPlayerBotController::BotWeapons(CPlayerAction &pa, SBotLogic &sbl) {
       continue;
     }
 
-    // Check if distance is okay
-    if (props.m_fTargetDist > fMax || props.m_fTargetDist < fMin) {
-      continue;
-    }
-
     // No ammo
     if (!GetSP()->sp_bInfiniteAmmo && !WPN_HAS_AMMO(penWeapons, iWeaponType)) {
       continue;
     }
 
-    FLOAT fDistRatio = (props.m_fTargetDist - fMin) / (fMax - fMin); // From min to max [0 .. 1]
-    FLOAT fMul = fAccuracy + (1 - fAccuracy) * (1 - fDistRatio); // From min to max [fAccuracy .. 1]
+    // First usable weapon is the best one
+    if (!bRate) {
+      iSelect = iWeaponType;
+      props.m_iBotWeapon = iWeapon;
+      break;
+    }
+
+    // Check damage (first weapon in the config out of the best ones)
+    const FLOAT fRating = RateBotWeapon(aWeapons[iWeapon], props.m_fTargetDist);
 
-    // Check damage
-    if (fLastDamage < aWeapons[iWeapon].bw_fDamage * fMul) {
+    if (fLastDamage < fRating || (fLastDamage == fRating && iSelect != WPN_NOTHING && iWeapon < props.m_iBotWeapon)) {
       // Select this weapon
       iSelect = iWeaponType;
-      fLastDamage = aWeapons[iWeapon].bw_fDamage * fMul;
+      fLastDamage = fRating;
 
       props.m_iBotWeapon = iWeapon;
     }
@@ -401,7 +411,7 @@ void CPlayerBotController::BotThinking(CPlayerAction &pa, SBotLogic &sbl) {
         FireWeapon(pa, sbl);
 
       } else if (Abs(props.m_tmShootTime - _pTimer->CurrentTick()) < 0.05f) {
-        props.Thought("Stop shooting");
+        props.Thought(BTH_STOPSHOOTING);
       }
 
       // Reset shooting time a few ticks later
@@ -412,7 +422,7 @@ void CPlayerBotController::BotThinking(CPlayerAction &pa, SBotLogic &sbl) {
         // This weapon has a certain shooting frequency
         if (tmShotFreq > 0.0f) {
           props.m_tmShootTime = _pTimer->CurrentTick() + tmShotFreq;
-          props.Thought("Shoot for %.2fs", tmShotFreq);
+          props.Thought(BTH_SHOOTFOR, 0, tmShotFreq);
 
         // No frequency
         } else {
@@ -140,7 +140,7 @@ struct DECL_DLL SBotProperties {
   };
 
   // Add new bot thought
-  void Thought(const char *strFormat, ...);
+  void Thought(EBotThought eType, INDEX iArg = 0, FLOAT fArg1 = 0.0f, FLOAT fArg2 = 0.0f, const char *strArg = NULL);
 };
 
 // Bot controller with properties that's attached to the bot entity
@@ -244,11 +244,14 @@ class DECL_DLL CPlayerBotController {
     // Set bot aim
     void BotAim(CPlayerAction &pa, SBotLogic &sbl);
 
+    // [Cecil] 2026-10-19: Find NavMesh point under the bot with ledges that can be trusted
+    CBotPathPoint *LedgePoint(SBotLogic &sbl);
+
     // Check for a bottomless pit in front of the bot in some direction
-    BOOL CheckPit(FLOAT3D vMovement, FLOAT fHeadingDir, FLOAT fDistance);
+    BOOL CheckPit(FLOAT3D vMovement, FLOAT fHeadingDir, FLOAT fDistance, CBotPathPoint *pbppLedges = NULL);
 
     // Try to avoid bottomless pits around the bot
-    FLOAT AvoidPits(const FLOAT3D &vMovement, FLOAT fDistance);
+    FLOAT AvoidPits(const FLOAT3D &vMovement, FLOAT fDistance, CBotPathPoint *pbppLedges = NULL);
 
     // Set bot movement
     void BotMovement(CPlayerAction &pa, SBotLogic &sbl);
@@ -22,6 +22,9 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 extern INDEX _iLastPoint = 0;
 
 extern BOOL LoadNavMeshPacket(void);
+extern BOOL _bFullNavmeshState;
+
+#include "Bots/PathFinding/NavmeshTransfer.h"
 %}
 
 class CBotModGlobal : CRationalEntity {
@@ -41,8 +44,10 @@ functions:
   void Write_t(CTStream *ostr) {
     CEntity::Write_t(ostr);
 
-    // write navmesh
-    _pNavmesh->WriteNavmesh(ostr);
+    // [Cecil] 2026-10-19: Write navmesh state instead of the whole navmesh if possible
+    _pNavmesh->WriteState(ostr, _bFullNavmeshState);
+    _bFullNavmeshState = FALSE;
+
     *ostr << _iLastPoint; // [Cecil] TEMP
 
     // write bots in order
@@ -52,14 +57,21 @@ functions:
       CPlayerBot *penBot = (CPlayerBot *)_aPlayerBots[iBot].pen;
       *ostr << (ULONG)penBot->en_ulID;
     }
+
+    // [Cecil] 2026-10-19: Write bots that are waiting to be added
+    CECIL_WriteBotQueue(*ostr);
   };
 
   void Read_t(CTStream *istr) {
     CEntity::Read_t(istr);
 
     // read navmesh
-    _pNavmesh->ReadNavmesh(istr);
     _pNavmesh->bnm_pwoWorld = GetWorld();
+    _pNavmesh->ReadState(istr);
+
+    // [Cecil] 2026-10-19: Forget about any navmesh that was being received
+    _ntNavmesh.Clear();
+    _pNavmesh->bnm_bAwaitingSync = FALSE;
 
     *istr >> _iLastPoint; // [Cecil] TEMP
 
@@ -76,6 +88,9 @@ functions:
       CPlayerBot *penBot = (CPlayerBot *)FindEntityByID(GetWorld(), ulID);
       penBot->InitBot();
     }
+
+    // [Cecil] 2026-10-19: Read bots that are waiting to be added
+    CECIL_ReadBotQueue(*istr);
   };
 
 procedures:
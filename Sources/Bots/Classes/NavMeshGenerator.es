@@ -21,6 +21,9 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 // [Cecil] TEMP: Last processed point in the NavMesh generation
 extern INDEX _iLastPoint;
 
+// [Cecil] 2026-10-19: For sending the generated NavMesh
+#include "Bots/PathFinding/NavmeshTransfer.h"
+
 // [Cecil] TEMP: Set loop at only one point at a time if dealing with edges
 #if NAVMESH_GEN_TYPE == NAVMESH_EDGES
   #define EDGES_LOOP m_ctLoop = 5
@@ -37,6 +40,7 @@ properties:
   1 INDEX m_iPoint = 0, // current point for checking
   2 INDEX m_ctPoints = 0, // amount of points in the NavMesh
   3 INDEX m_ctLoop = 10, // amount of points to process per tick
+  4 INDEX m_iLedgePoint = 0, // [Cecil] 2026-10-19: current point for checking ledges
 
 components:
 
@@ -69,9 +73,15 @@ procedures:
       CPrintF("[NavMeshGenerator]: NavMesh doesn't have any points!\n");
     }
 
+    // [Cecil] 2026-10-19: Bots wait for the connected NavMesh from the server
+    _pNavmesh->bnm_bAwaitingSync = TRUE;
+
     // go through points
     while (m_iPoint < m_ctPoints) {
-      _pNavmesh->ConnectPoints(m_iPoint);
+      // Only the server connects points
+      if (_pNetwork->IsServer()) {
+        _pNavmesh->ConnectPoints(m_iPoint);
+      }
       
       m_iPoint++;
 
@@ -82,8 +92,28 @@ procedures:
 
     _iLastPoint = m_iPoint; // [Cecil] TEMP
 
-    // Cleanup useless points
-    _pNavmesh->CleanupPoints();
+    // Cleanup useless points and send the NavMesh to everyone
+    if (_pNetwork->IsServer()) {
+      _pNavmesh->CleanupPoints();
+
+      // [Cecil] 2026-10-19: Check ground along all connections for bots
+      m_iLedgePoint = 0;
+
+      while (m_iLedgePoint < _pNavmesh->bnm_aPoints.Count()) {
+        _pNavmesh->CheckLedges(m_iLedgePoint);
+
+        m_iLedgePoint++;
+        if ((m_iLedgePoint % m_ctLoop) == 0) {
+          autowait(0.05f);
+        }
+      }
+
+      CPrintF("[NavMeshGenerator]: Checked ledges of %d points\n", m_iLedgePoint);
+
+      CTMemoryStream strmNavmesh;
+      _pNavmesh->WriteNavmesh(&strmNavmesh);
+      CECIL_SendNavmeshData(strmNavmesh);
+    }
 
     Destroy();
     return;
@@ -113,6 +113,11 @@ functions:
     CPlayer::ApplyAction(CPlayerAction(), 0.0f);
   };
 
+  // [Cecil] 2026-10-19: Bots only need the ray results without any HUD info
+  virtual void UpdateTargetingInfo(void) {
+    GetPlayerWeapons()->UpdateRayHit();
+  };
+
   // Apply action for bots
   virtual void BotApplyAction(CPlayerAction &paAction) {
     // While alive
@@ -121,12 +126,18 @@ functions:
         // Bot's brain
         SBotLogic sbl;
 
+        // [Cecil] 2026-10-19: Profile bot logic
+        _pfBotModProfile.StartTimer(CBotModProfile::PTI_THINKING);
+
         // Main bot logic
         m_bot.BotThinking(paAction, sbl);
 
         // Weapon functions
         m_bot.BotWeapons(paAction, sbl);
 
+        _pfBotModProfile.StopTimer(CBotModProfile::PTI_THINKING);
+        _pfBotModProfile.IncrementTimerAveragingCounter(CBotModProfile::PTI_THINKING);
+
         m_bot.BotSelectNewWeapon(sbl.iDesiredWeapon);
       }
 
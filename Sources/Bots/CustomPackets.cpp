@@ -17,12 +17,20 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #include "CustomPackets.h"
 #include "Bots/NetworkPatch/ServerIntegration.h"
 
+// [Cecil] 2026-10-19: Write the whole navmesh into the next session state
+BOOL _bFullNavmeshState = FALSE;
+
 // [Cecil] 2022-04-27: Handle packets coming from a client (CServer::Handle alternative)
 BOOL ServerHandlePacket(CMessageDispatcher &md, INDEX iClient, CNetworkMessage &nmReceived) {
   CServer &srv = _pNetwork->ga_srvServer;
 
   switch (nmReceived.GetType())
   {
+    // [Cecil] 2026-10-19: Joining clients might not have the navmesh file
+    case MSG_REQ_CONNECTREMOTESESSIONSTATE: {
+      _bFullNavmeshState = TRUE;
+    } break;
+
     // [Cecil] Sandbox actions
     case MSG_CECIL_SANDBOX: {
       INDEX iAction;
@@ -31,7 +39,7 @@ BOOL ServerHandlePacket(CMessageDispatcher &md, INDEX iClient, CNetworkMessage &
       extern INDEX MOD_bClientSandbox;
 
       // If not an admin or no permissions
-      if (!_cmiComm.Server_IsClientLocal(iClient) && (iAction <= ESA_LAST_ADMIN || !MOD_bClientSandbox)) {
+      if (!_cmiComm.Server_IsClientLocal(iClient) && (IsAdminAction(iAction) || !MOD_bClientSandbox)) {
         nmReceived.IgnoreContents();
 
         // Reply to the client
@@ -74,8 +82,13 @@ BOOL HandleCustomPacket(CSessionState *pses, CNetworkMessage &nmMessage) {
       }
 
       // Perform sandbox action
+      _pfBotModProfile.StartTimer(CBotModProfile::PTI_SANDBOXPACKETS); // [Cecil] 2026-10-19
+
       CECIL_SandboxAction(pen, iAction, nmMessage);
 
+      _pfBotModProfile.StopTimer(CBotModProfile::PTI_SANDBOXPACKETS);
+      _pfBotModProfile.IncrementTimerAveragingCounter(CBotModProfile::PTI_SANDBOXPACKETS);
+
     } return FALSE;
   }
 
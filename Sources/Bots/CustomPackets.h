@@ -54,8 +54,21 @@ enum ESandboxAction {
   ESA_NAVMESH_RANGE,  // Change point's range
   ESA_NAVMESH_NEXT,   // Change point's next important point
   ESA_NAVMESH_LOCK,   // Change point's lock entity
+
+  // [Cecil] 2026-10-19: Admin actions that have been added later (new actions go at the end to keep old demos working)
+  ESA_NAVMESH_DATA,   // Receive the NavMesh from the server
+  ESA_NAVMESH_HEADER, // Begin receiving the NavMesh from the server
+  ESA_QUEUEBOTS,      // Add multiple bots over multiple ticks
+};
+
+// [Cecil] 2026-10-19: Check if only an admin can perform some action
+inline BOOL IsAdminAction(INDEX iAction) {
+  return (iAction <= ESA_LAST_ADMIN || iAction == ESA_NAVMESH_DATA || iAction == ESA_NAVMESH_HEADER || iAction == ESA_QUEUEBOTS);
 };
 
+// [Cecil] 2026-10-19: Write the whole navmesh into the next session state
+extern BOOL _bFullNavmeshState;
+
 // [Cecil] 2022-04-27: Handle packets coming from a client (CServer::Handle alternative)
 BOOL ServerHandlePacket(CMessageDispatcher &md, INDEX iClient, CNetworkMessage &nmReceived);
 
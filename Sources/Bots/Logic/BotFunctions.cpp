@@ -23,14 +23,16 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 
 // Constructor
 SBotLogic::SBotLogic(void) : ulFlags(0), boxTarget(FLOAT3D(0.0f, 0.0f, 0.0f), FLOAT3D(0.0f, 0.0f, 0.0f)),
-  aAim(0.0f, 0.0f, 0.0f), plBotView(FLOAT3D(0.0f, 0.0f, 0.0f), ANGLE3D(0.0f, 0.0f, 0.0f)), iDesiredWeapon(WPN_DEFAULT_1)
+  aAim(0.0f, 0.0f, 0.0f), plBotView(FLOAT3D(0.0f, 0.0f, 0.0f), ANGLE3D(0.0f, 0.0f, 0.0f)), iDesiredWeapon(WPN_DEFAULT_1),
+  pbppClosest(NULL)
 {
   aWeapons = PickWeaponConfig();
+  pbwtWeapons = PickWeaponTable();
 };
 
 // [Cecil] 2019-05-28: Find nearest NavMesh point to some position
 CBotPathPoint *NearestNavMeshPointPos(CEntity *pen, const FLOAT3D &vCheck) {
-  if (_pNavmesh->bnm_aPoints.Count() <= 0) {
+  if (!_pNavmesh->IsUsable()) {
     return NULL;
   }
 
@@ -69,7 +71,7 @@ CBotPathPoint *NearestNavMeshPointPos(CEntity *pen, const FLOAT3D &vCheck) {
 
 // [Cecil] 2021-06-21: Find nearest NavMesh point to the bot
 CBotPathPoint *CPlayerBotController::NearestNavMeshPointBot(BOOL bSkipCurrent) {
-  if (_pNavmesh->bnm_aPoints.Count() <= 0) {
+  if (!_pNavmesh->IsUsable()) {
     return NULL;
   }
 
@@ -172,6 +174,7 @@ BOOL CPlayerBotController::CastBotRay(CEntity *penTarget, const SBotLogic &sbl,
                   + sbl.boxTarget.Center() * penTarget->GetRotationMatrix();
 
   CCastRay crBot(pen, sbl.ViewPos(), vTarget);
+  _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_RAYS); // [Cecil] 2026-10-19
 
   crBot.cr_ttHitModels = CCastRay::TT_NONE;
   crBot.cr_bHitTranslucentPortals = TRUE;
@@ -184,6 +187,7 @@ BOOL CPlayerBotController::CastBotRay(CEntity *penTarget, const SBotLogic &sbl,
 // [Cecil] Cast path point ray
 BOOL CastPathPointRay(const FLOAT3D &vSource, const FLOAT3D &vPoint, FLOAT &fDist, BOOL bPhysical) {
   CCastRay crBot(NULL, vSource, vPoint);
+  _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_RAYS); // [Cecil] 2026-10-19
 
   crBot.cr_ttHitModels = CCastRay::TT_NONE;
   crBot.cr_bHitTranslucentPortals = TRUE;
@@ -239,6 +243,10 @@ CEntity *CPlayerBotController::ClosestEnemy(FLOAT &fLast, const SBotLogic &sbl)
   INDEX iPriority = 0;
   CEntity *penLastTarget = NULL;
 
+  // [Cecil] 2026-10-19: Profile enemy searching
+  _pfBotModProfile.StartTimer(CBotModProfile::PTI_PERCEPTION);
+  _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_ENTITIES_SCANNED, pen->GetWorld()->wo_cenEntities.Count());
+
   // For each entity in the world
   {FOREACHINDYNAMICCONTAINER(pen->GetWorld()->wo_cenEntities, CEntity, iten) {
     CEntity *penCheck = iten;
@@ -303,6 +311,9 @@ CEntity *CPlayerBotController::ClosestEnemy(FLOAT &fLast, const SBotLogic &sbl)
     iPriority = 0;
   }}
 
+  _pfBotModProfile.StopTimer(CBotModProfile::PTI_PERCEPTION);
+  _pfBotModProfile.IncrementTimerAveragingCounter(CBotModProfile::PTI_PERCEPTION);
+
   // Target is too far
   if (fLast < 0.0f) {
     fLast = 1000.0f;
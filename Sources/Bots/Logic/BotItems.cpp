@@ -67,7 +67,7 @@ void CPlayerBotController::BotItemSearch(SBotLogic &sbl) {
         props.m_penLastItem = penItem;
         props.m_tmLastItemSearch = _pTimer->CurrentTick() + SETTINGS.fItemSearchCD;
 
-        props.Thought("Going for ^c7f7fff%s", penItem->en_pecClass->ec_pdecDLLClass->dec_strName);
+        props.Thought(BTH_GOINGFORITEM, 0, 0.0f, 0.0f, penItem->en_pecClass->ec_pdecDLLClass->dec_strName);
       }
     }
   }
@@ -84,7 +84,7 @@ void CPlayerBotController::BotItemSearch(SBotLogic &sbl) {
       props.m_penLastItem = NULL;
       props.m_tmLastItemSearch = 0.0f;
 
-      props.Thought("^c7f7fffItem is no longer pickable");
+      props.Thought(BTH_ITEMNOTPICKABLE);
     }
   }
 };
@@ -210,6 +210,10 @@ CEntity *CPlayerBotController::ClosestItemType(const CDLLEntityClass &decClass,
   CEntity *penReturn = NULL;
   fDist = MAX_ITEM_DIST;
 
+  // [Cecil] 2026-10-19: Profile item searching
+  _pfBotModProfile.StartTimer(CBotModProfile::PTI_PERCEPTION);
+  _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_ENTITIES_SCANNED, pen->GetWorld()->wo_cenEntities.Count());
+
   // For each bot item
   {FOREACHINDYNAMICCONTAINER(pen->GetWorld()->wo_cenEntities, CEntity, iten) {
     CEntity *penCheck = iten;
@@ -237,6 +241,9 @@ CEntity *CPlayerBotController::ClosestItemType(const CDLLEntityClass &decClass,
     }
   }}
 
+  _pfBotModProfile.StopTimer(CBotModProfile::PTI_PERCEPTION);
+  _pfBotModProfile.IncrementTimerAveragingCounter(CBotModProfile::PTI_PERCEPTION);
+
   // If it's the same item as before, don't bother
   if (penReturn == props.m_penLastItem) {
     penReturn = NULL;
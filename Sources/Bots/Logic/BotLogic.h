@@ -32,11 +32,13 @@ struct SBotLogic {
   ULONG ulFlags; // Things bot is thinking about
   FLOATaabbox3D boxTarget; // Collision box of a target
   const struct SBotWeaponConfig *aWeapons; // Selected weapon config
+  const struct SBotWeaponTable *pbwtWeapons; // [Cecil] 2026-10-19: Weapon table of the selected config
 
   CPlacement3D plBotView; // Bot's viewpoint
   ANGLE3D aAim; // In which direction bot needs to aim
 
   INDEX iDesiredWeapon; // Weapon type for the bot to select
+  class CBotPathPoint *pbppClosest; // [Cecil] 2026-10-19: Closest NavMesh point found during this tick
 
   // Constructor
   SBotLogic(void);
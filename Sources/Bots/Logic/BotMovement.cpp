@@ -32,10 +32,13 @@ BOOL CPlayerBotController::NoPosChange(void) {
 
 // [Cecil] 2021-06-14: Try to find some path
 void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
-  if (_pNavmesh->bnm_aPoints.Count() <= 0) {
+  if (!_pNavmesh->IsUsable()) {
     return;
   }
 
+  // [Cecil] 2026-10-19: Lock states for this tick
+  _pNavmesh->UpdateLocks();
+
   const FLOAT3D &vBotPos = pen->GetPlacement().pl_PositionVector;
 
   CEntity *penTarget = NULL;
@@ -71,7 +74,7 @@ void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
           props.m_pbppTarget = pbppImportant;
           props.m_bImportantPoint = TRUE;
 
-          props.Thought("New important point: ^caf3f3f%d", pbppImportant->bpp_iIndex);
+          props.Thought(BTH_IMPORTANTPOINT, pbppImportant->bpp_iIndex);
         }
       }
 
@@ -102,7 +105,7 @@ void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
       // Reset important point
       if (props.m_pbppTarget->bpp_pbppNext == NULL) {
         props.m_bImportantPoint = FALSE;
-        props.Thought("^caf3f3fReached important point");
+        props.Thought(BTH_REACHEDIMPORTANT);
 
         // Reset the path if no target
         if (penTarget == NULL) {
@@ -114,7 +117,7 @@ void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
       // Proceed to the next important point
       } else {
         props.m_pbppTarget = props.m_pbppTarget->bpp_pbppNext;
-        props.Thought("^c3f3fafNext important point");
+        props.Thought(BTH_NEXTIMPORTANT);
       }
 
       // Use important entity
@@ -152,6 +155,9 @@ void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
     // Find first point to go to
     CBotPathPoint *pbppClosest = NearestNavMeshPointBot(FALSE);
 
+    // [Cecil] 2026-10-19: Remember it for the rest of the tick
+    sbl.pbppClosest = pbppClosest;
+
     // Can see the enemy or don't have any point yet
     BOOL bSelectTarget = (bSeeTarget || props.m_pbppCurrent == NULL);
 
@@ -162,21 +168,36 @@ void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
 
     // [Cecil] 2022-05-11: Construct a path as long as there's a target point
     if (props.m_pbppTarget != NULL) {
-      CTString strThought;
+      // [Cecil] 2026-10-19: Point to think about
+      EBotThought eThought = BTH_NONE;
+      CBotPathPoint *pbppThought = NULL;
 
       // [Cecil] 2021-06-21: Just go to the first point if haven't reached it yet
       if (pbppReached != pbppClosest) {
         props.m_pbppCurrent = pbppClosest;
         props.m_ulPointFlags = pbppClosest->bpp_ulFlags;
-      
-        FLOAT3D vToPoint = (pbppClosest->bpp_vPos - vBotPos).SafeNormalize();
-        ANGLE3D aToPoint; DirectionVectorToAngles(vToPoint, aToPoint);
-        strThought.PrintF("Closest point ^c00ff00%d ^c00af00[%.1f, %.1f]",
-                          pbppClosest->bpp_iIndex, aToPoint(1), aToPoint(2));
+
+        eThought = BTH_CLOSESTPOINT;
+        pbppThought = pbppClosest;
 
       // Pick the next point on the path
       } else {
-        CBotPathPoint *pbppNext = _pNavmesh->FindNextPoint(pbppClosest, props.m_pbppTarget);
+        // [Cecil] 2026-10-19: Profile path searching
+        _pfBotModProfile.StartTimer(CBotModProfile::PTI_PATHFINDING);
+
+        // [Cecil] 2026-10-19: Bots going to the same point share the same paths
+        INDEX ctRequesters = 0;
+
+        for (INDEX iBot = 0; iBot < _aPlayerBots.Count(); iBot++) {
+          if (_aPlayerBots[iBot].props.m_pbppTarget == props.m_pbppTarget) {
+            ctRequesters++;
+          }
+        }
+
+        CBotPathPoint *pbppNext = _pNavmesh->FlowNextPoint(pbppClosest, props.m_pbppTarget, ctRequesters);
+
+        _pfBotModProfile.StopTimer(CBotModProfile::PTI_PATHFINDING);
+        _pfBotModProfile.IncrementTimerAveragingCounter(CBotModProfile::PTI_PATHFINDING);
 
         // Remember the point if found
         if (pbppNext != NULL) {
@@ -199,10 +220,8 @@ void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
           // Get flags of the closest point or override them
           props.m_ulPointFlags = (pbppNext->bpp_ulFlags & PPF_OVERRIDE) ? pbppNext->bpp_ulFlags : pbppClosest->bpp_ulFlags;
 
-          FLOAT3D vToPoint = (pbppNext->bpp_vPos - vBotPos).SafeNormalize();
-          ANGLE3D aToPoint; DirectionVectorToAngles(vToPoint, aToPoint);
-          strThought.PrintF("%s ^c00ff00%d ^c00af00[%.1f, %.1f]", (bStay ? "Staying at" : "Next point"),
-                            pbppNext->bpp_iIndex, aToPoint(1), aToPoint(2));
+          eThought = (bStay ? BTH_STAYINGATPOINT : BTH_NEXTPOINT);
+          pbppThought = pbppNext;
 
         // No next point
         } else {
@@ -211,8 +230,12 @@ void CPlayerBotController::BotPathFinding(SBotLogic &sbl) {
         }
       }
 
-      if (props.m_pbppCurrent != NULL) {
-        props.Thought(strThought);
+      // [Cecil] 2026-10-19: Only calculate direction to the point if it's going to be recorded
+      if (props.m_pbppCurrent != NULL && pbppThought != NULL && SBotThoughts::Enabled()) {
+        FLOAT3D vToPoint = (pbppThought->bpp_vPos - vBotPos).SafeNormalize();
+        ANGLE3D aToPoint; DirectionVectorToAngles(vToPoint, aToPoint);
+
+        props.Thought(eThought, pbppThought->bpp_iIndex, aToPoint(1), aToPoint(2));
       }
 
     // No target point
@@ -337,8 +360,77 @@ void CPlayerBotController::BotAim(CPlayerAction &pa, SBotLogic &sbl) {
   }
 };
 
+// [Cecil] 2026-10-19: How far from the ledge point the bot can be
+#define LEDGE_POINT_DIST   1.0f
+#define LEDGE_POINT_HEIGHT 2.0f
+
+// [Cecil] 2026-10-19: Find NavMesh point under the bot with ledges that can be trusted
+CBotPathPoint *CPlayerBotController::LedgePoint(SBotLogic &sbl) {
+  // Ledges are only checked with normal gravity
+  if (pen->en_vGravityDir(2) > -0.99f) {
+    return NULL;
+  }
+
+  // Standing on something that moves
+  CEntity *penGround = pen->en_penReference;
+
+  if (penGround != NULL && penGround->GetPhysicsFlags() & EPF_MOVABLE) {
+    return NULL;
+  }
+
+  // Only use the point that has already been found during this tick
+  CBotPathPoint *pbpp = sbl.pbppClosest;
+
+  // No ledges or something may block the way
+  if (pbpp == NULL || pbpp->bpp_aLedges.Count() == 0 || ASSERT_ENTITY(pbpp->bpp_penLock)) {
+    return NULL;
+  }
+
+  // Too far from the point
+  const FLOAT3D vDiff = (pbpp->bpp_vPos - pen->GetPlacement().pl_PositionVector);
+
+  if (HorizontalDiff(vDiff, pen->en_vGravityDir).Length() > pbpp->bpp_fRange + LEDGE_POINT_DIST
+   || VerticalDiff(vDiff, pen->en_vGravityDir).Length() > LEDGE_POINT_HEIGHT) {
+    return NULL;
+  }
+
+  return pbpp;
+};
+
+// [Cecil] 2026-10-19: Check if there's ground at some position according to ledges of a point
+static BOOL GroundOnLedges(CBotPathPoint *pbpp, const FLOAT3D &vCheck) {
+  FOREACHINDYNAMICCONTAINER(pbpp->bpp_cbppPoints, CBotPathPoint, itbpp) {
+    CBotPathPoint *pbppTarget = itbpp;
+
+    // Only connections with ground all the way
+    if (pbpp->GetLedge(pbppTarget) != PLF_CHECKED) {
+      continue;
+    }
+
+    // Find the closest position on the connection horizontally
+    const FLOAT3D vConnection = (pbppTarget->bpp_vPos - pbpp->bpp_vPos);
+    const FLOAT3D vToCheck = (vCheck - pbpp->bpp_vPos);
+
+    const FLOAT fLengthSq = vConnection(1) * vConnection(1) + vConnection(3) * vConnection(3);
+    FLOAT fRatio = 0.0f;
+
+    if (fLengthSq > 0.0001f) {
+      fRatio = Clamp((vToCheck(1) * vConnection(1) + vToCheck(3) * vConnection(3)) / fLengthSq, 0.0f, 1.0f);
+    }
+
+    const FLOAT3D vOffset = (vToCheck - vConnection * fRatio);
+
+    // Within the checked area
+    if (FLOAT3D(vOffset(1), 0.0f, vOffset(3)).Length() <= NAVMESH_LEDGE_WIDTH && Abs(vOffset(2)) <= LEDGE_POINT_HEIGHT) {
+      return TRUE;
+    }
+  }
+
+  return FALSE;
+};
+
 // Check for a bottomless pit in front of the bot in some direction
-BOOL CPlayerBotController::CheckPit(FLOAT3D vMovement, FLOAT fHeadingDir, FLOAT fDistance) {
+BOOL CPlayerBotController::CheckPit(FLOAT3D vMovement, FLOAT fHeadingDir, FLOAT fDistance, CBotPathPoint *pbppLedges) {
   if (fDistance <= 0.0f) {
     return FALSE;
   }
@@ -354,6 +446,14 @@ BOOL CPlayerBotController::CheckPit(FLOAT3D vMovement, FLOAT fHeadingDir, FLOAT
 
   const FLOAT3D vBot = pen->GetPlacement().pl_PositionVector;
 
+  // [Cecil] 2026-10-19: Precomputed ledges say that there's ground
+  if (pbppLedges != NULL && GroundOnLedges(pbppLedges, vBot + vMovement * pen->GetRotationMatrix())) {
+    _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_PIT_LEDGES);
+    return FALSE;
+  }
+
+  _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_PIT_PROBES);
+
   // Set custom values for the check
   const FLOAT3D vNextPos = pen->en_vNextPosition;
   const FLOAT fStepDnHeight = pen->en_fStepDnHeight;
@@ -372,19 +472,19 @@ BOOL CPlayerBotController::CheckPit(FLOAT3D vMovement, FLOAT fHeadingDir, FLOAT
 };
 
 // Try to avoid bottomless pits around the bot
-FLOAT CPlayerBotController::AvoidPits(const FLOAT3D &vMovement, FLOAT fDistance) {
+FLOAT CPlayerBotController::AvoidPits(const FLOAT3D &vMovement, FLOAT fDistance, CBotPathPoint *pbppLedges) {
   const FLOAT fSideAngle = 45.0f * props.m_fSideDir;
 
   // Check on one side
-  if (!CheckPit(vMovement, fSideAngle, fDistance)) {
+  if (!CheckPit(vMovement, fSideAngle, fDistance, pbppLedges)) {
     return fSideAngle;
 
   // Check on the opposite side
-  } else if (!CheckPit(vMovement, -fSideAngle, fDistance)) {
+  } else if (!CheckPit(vMovement, -fSideAngle, fDistance, pbppLedges)) {
     return -fSideAngle;
 
   // Check closer behind
-  } else if (!CheckPit(vMovement, 180.0f, fDistance - 1.0f)) {
+  } else if (!CheckPit(vMovement, 180.0f, fDistance - 1.0f, pbppLedges)) {
     return 180.0f;
   }
 
@@ -515,10 +615,13 @@ void CPlayerBotController::BotMovement(CPlayerAction &pa, SBotLogic &sbl) {
 
   // Check if there's a bottomless pit ahead
   if (SETTINGS.bAvoidPits && !bInLiquid && props.m_pbppCurrent == NULL) {
+    // [Cecil] 2026-10-19: Rely on NavMesh ledges around the bot before checking the world
+    CBotPathPoint *pbppLedges = LedgePoint(sbl);
+
     // If found a pit in the movement direction
-    if (CheckPit(vBotMovement, 0.0f, 3.0f)) {
+    if (CheckPit(vBotMovement, 0.0f, 3.0f, pbppLedges)) {
       // Able to jump over
-      if (SETTINGS.bJump && !CheckPit(vBotMovement, 0.0f, 8.0f)) {
+      if (SETTINGS.bJump && !CheckPit(vBotMovement, 0.0f, 8.0f, pbppLedges)) {
         fVerticalMove = 1.0f;
 
       } else {
@@ -528,7 +631,7 @@ void CPlayerBotController::BotMovement(CPlayerAction &pa, SBotLogic &sbl) {
         DirectionVectorToAngles(vBotMovement, aMoveDir);
 
         // Check 3 meters in front
-        FLOAT fAvoid = AvoidPits(vBotMovement, 3.0f);
+        FLOAT fAvoid = AvoidPits(vBotMovement, 3.0f, pbppLedges);
 
         if (fAvoid != 0.0f) {
           // Go to the side
@@ -536,7 +639,7 @@ void CPlayerBotController::BotMovement(CPlayerAction &pa, SBotLogic &sbl) {
           AnglesToDirectionVector(aMoveDir, vBotMovement);
 
           // Check 2 meters to the side
-          FLOAT fAvoid2 = AvoidPits(vBotMovement, 2.0f);
+          FLOAT fAvoid2 = AvoidPits(vBotMovement, 2.0f, pbppLedges);
 
           if (fAvoid2 != 0.0f) {
             // Go to the side
@@ -553,7 +656,7 @@ void CPlayerBotController::BotMovement(CPlayerAction &pa, SBotLogic &sbl) {
           AnglesToDirectionVector(aMoveDir, vBotMovement);
         }
 
-        props.Thought("Bottomless pit: %d", (INDEX)fAvoid);
+        props.Thought(BTH_BOTTOMLESSPIT, (INDEX)fAvoid);
       }
     }
 
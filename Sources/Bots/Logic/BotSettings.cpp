@@ -185,3 +185,321 @@ void SBotSettings::Reset(const EDifficulty eDiff) {
 
   aPresets[eDiff](*this);
 };
+
+// [Cecil] 2026-10-19: Current version of serialized bot settings
+#define BOT_SETTINGS_VERSION 1
+
+// Amount of settings in savegames from before the versioning
+#define LEGACY_BOT_SETTINGS 32
+
+// Setting value types
+enum EBotSettingType {
+  BST_INDEX,
+  BST_FLOAT,
+};
+
+// Serializable setting field
+struct SBotSettingField {
+  UBYTE ubTag;   // unique tag of the setting
+  UBYTE ubType;  // value type
+  SLONG slOffset; // offset of the field in the structure
+};
+
+#define BOT_SETTING(_Tag, _Type, _Field) { _Tag, _Type, offsetof(SBotSettings, _Field) }
+
+// All serializable settings (changing or reusing tags can break previously saved games)
+static const SBotSettingField _aSettingFields[] = {
+  BOT_SETTING( 0, BST_INDEX, b3rdPerson),
+  BOT_SETTING( 1, BST_INDEX, iCrosshair),
+  BOT_SETTING( 2, BST_FLOAT, fRespawnDelay),
+  BOT_SETTING( 3, BST_INDEX, bSniperZoom),
+  BOT_SETTING( 4, BST_INDEX, bShooting),
+  BOT_SETTING( 5, BST_FLOAT, fShootAngle),
+  BOT_SETTING( 6, BST_FLOAT, fAccuracyAngle),
+  BOT_SETTING( 7, BST_FLOAT, fRotSpeedDist),
+  BOT_SETTING( 8, BST_FLOAT, fRotSpeedMin),
+  BOT_SETTING( 9, BST_FLOAT, fRotSpeedMax),
+  BOT_SETTING(10, BST_FLOAT, fRotSpeedLimit),
+  BOT_SETTING(11, BST_FLOAT, fWeaponCD),
+  BOT_SETTING(12, BST_FLOAT, fTargetCD),
+  BOT_SETTING(13, BST_INDEX, iFollowPlayers),
+  BOT_SETTING(14, BST_FLOAT, fSpeedMul),
+  BOT_SETTING(15, BST_INDEX, bStrafe),
+  BOT_SETTING(16, BST_INDEX, bJump),
+  BOT_SETTING(17, BST_INDEX, bAvoidPits),
+  BOT_SETTING(18, BST_FLOAT, fPrediction),
+  BOT_SETTING(19, BST_FLOAT, fPredictRnd),
+  BOT_SETTING(20, BST_INDEX, iAllowedWeapons),
+  BOT_SETTING(21, BST_INDEX, iTargetType),
+  BOT_SETTING(22, BST_INDEX, bTargetSearch),
+  BOT_SETTING(23, BST_FLOAT, fImportantChance),
+  BOT_SETTING(24, BST_INDEX, bItemSearch),
+  BOT_SETTING(25, BST_FLOAT, fItemSearchCD),
+  BOT_SETTING(26, BST_INDEX, bItemVisibility),
+  BOT_SETTING(27, BST_FLOAT, fWeaponDist),
+  BOT_SETTING(28, BST_FLOAT, fHealthSearch),
+  BOT_SETTING(29, BST_FLOAT, fHealthDist),
+  BOT_SETTING(30, BST_FLOAT, fArmorDist),
+  BOT_SETTING(31, BST_FLOAT, fAmmoDist),
+};
+
+static const INDEX _ctSettingFields = ARRAYCOUNT(_aSettingFields);
+
+// Bits for setting tags and the amount of written settings
+#define SETTING_TAG_BITS 6
+
+// Small integers (-1 to 14) are packed into fewer bits
+#define SMALL_INDEX_BITS 4
+#define SMALL_INDEX_MIN -1
+#define SMALL_INDEX_MAX (SMALL_INDEX_MIN + (1 << SMALL_INDEX_BITS) - 1)
+
+// Raw value of a setting field
+static inline ULONG &FieldValue(SBotSettings &sbs, const SBotSettingField &bsf) {
+  return *(ULONG *)((UBYTE *)&sbs + bsf.slOffset);
+};
+
+static inline ULONG FieldValue(const SBotSettings &sbs, const SBotSettingField &bsf) {
+  return *(const ULONG *)((const UBYTE *)&sbs + bsf.slOffset);
+};
+
+// Find setting field by its tag
+static const SBotSettingField *FindSettingField(UBYTE ubTag) {
+  for (INDEX i = 0; i < _ctSettingFields; i++) {
+    if (_aSettingFields[i].ubTag == ubTag) {
+      return &_aSettingFields[i];
+    }
+  }
+
+  return NULL;
+};
+
+// Default settings for a certain difficulty preset
+static SBotSettings PresetSettings(SBotSettings::EDifficulty eDiff) {
+  SBotSettings sbs;
+  sbs.Reset(eDiff);
+
+  return sbs;
+};
+
+// Bit-packed bot settings
+class CSettingBits {
+  public:
+    UBYTE sb_aubData[512];
+    INDEX sb_iBit;
+
+    CSettingBits(void) : sb_iBit(0) {
+      memset(sb_aubData, 0, sizeof(sb_aubData));
+    };
+
+    // Amount of used bytes
+    inline SLONG Size(void) const {
+      return (sb_iBit + 7) / 8;
+    };
+
+    void Write(ULONG ulValue, INDEX ctBits) {
+      for (INDEX i = 0; i < ctBits; i++, sb_iBit++) {
+        if (ulValue & (1UL << i)) {
+          sb_aubData[sb_iBit >> 3] |= UBYTE(1 << (sb_iBit & 7));
+        }
+      }
+    };
+
+    ULONG Read(INDEX ctBits) {
+      ULONG ulValue = 0;
+
+      for (INDEX i = 0; i < ctBits; i++, sb_iBit++) {
+        // Out of data
+        if ((sb_iBit >> 3) >= sizeof(sb_aubData)) {
+          break;
+        }
+
+        if (sb_aubData[sb_iBit >> 3] & (1 << (sb_iBit & 7))) {
+          ulValue |= (1UL << i);
+        }
+      }
+
+      return ulValue;
+    };
+};
+
+// Pack settings that differ from the preset
+static void PackSettings(const SBotSettings &sbs, CSettingBits &bits) {
+  const SBotSettings::EDifficulty ePreset = sbs.ClosestPreset();
+  const SBotSettings sbsPreset = PresetSettings(ePreset);
+
+  INDEX ctChanged = 0;
+  INDEX i;
+
+  for (i = 0; i < _ctSettingFields; i++) {
+    if (FieldValue(sbs, _aSettingFields[i]) != FieldValue(sbsPreset, _aSettingFields[i])) {
+      ctChanged++;
+    }
+  }
+
+  bits.Write(ePreset, 2);
+  bits.Write(ctChanged, SETTING_TAG_BITS + 1);
+
+  for (i = 0; i < _ctSettingFields; i++) {
+    const SBotSettingField &bsf = _aSettingFields[i];
+    const ULONG ulValue = FieldValue(sbs, bsf);
+
+    if (ulValue == FieldValue(sbsPreset, bsf)) continue;
+
+    bits.Write(bsf.ubTag, SETTING_TAG_BITS);
+
+    if (bsf.ubType == BST_INDEX) {
+      const INDEX iValue = (INDEX)ulValue;
+      const BOOL bSmall = (iValue >= SMALL_INDEX_MIN && iValue <= SMALL_INDEX_MAX);
+      bits.Write(bSmall, 1);
+
+      if (bSmall) {
+        bits.Write(iValue - SMALL_INDEX_MIN, SMALL_INDEX_BITS);
+        continue;
+      }
+    }
+
+    bits.Write(ulValue, 32);
+  }
+};
+
+// Unpack settings on top of the preset
+static void UnpackSettings(SBotSettings &sbs, CSettingBits &bits) {
+  const INDEX iPreset = bits.Read(2);
+  const INDEX ctChanged = bits.Read(SETTING_TAG_BITS + 1);
+
+  sbs = PresetSettings((SBotSettings::EDifficulty)Clamp(iPreset, 0L, INDEX(SBotSettings::BDF_LAST - 1)));
+
+  for (INDEX i = 0; i < ctChanged; i++) {
+    const SBotSettingField *pbsf = FindSettingField(bits.Read(SETTING_TAG_BITS));
+
+    // Can't know the size of unknown settings
+    if (pbsf == NULL) {
+      CPrintF("Unknown bot setting in serialized data!\n");
+      return;
+    }
+
+    ULONG ulValue;
+
+    if (pbsf->ubType == BST_INDEX && bits.Read(1)) {
+      ulValue = ULONG(INDEX(bits.Read(SMALL_INDEX_BITS)) + SMALL_INDEX_MIN);
+    } else {
+      ulValue = bits.Read(32);
+    }
+
+    FieldValue(sbs, *pbsf) = ulValue;
+  }
+};
+
+// Find difficulty preset with the least amount of different settings
+SBotSettings::EDifficulty SBotSettings::ClosestPreset(void) const {
+  EDifficulty eClosest = BDF_NORMAL;
+  INDEX ctLeastChanged = _ctSettingFields + 1;
+
+  for (INDEX iDiff = 0; iDiff < BDF_LAST; iDiff++) {
+    const SBotSettings sbsPreset = PresetSettings((EDifficulty)iDiff);
+    INDEX ctChanged = 0;
+
+    for (INDEX i = 0; i < _ctSettingFields; i++) {
+      if (FieldValue(*this, _aSettingFields[i]) != FieldValue(sbsPreset, _aSettingFields[i])) {
+        ctChanged++;
+      }
+    }
+
+    if (ctChanged < ctLeastChanged) {
+      eClosest = (EDifficulty)iDiff;
+      ctLeastChanged = ctChanged;
+    }
+  }
+
+  return eClosest;
+};
+
+// [Cecil] 2026-10-19: Write and read only settings that differ from the closest preset
+void SBotSettings::Write_t(CTStream &strm) const {
+  CSettingBits bits;
+  PackSettings(*this, bits);
+
+  strm.WriteID_t("BSET"); // Bot SETtings
+  strm << INDEX(BOT_SETTINGS_VERSION);
+  strm << INDEX(bits.Size());
+  strm.Write_t(bits.sb_aubData, bits.Size());
+};
+
+void SBotSettings::Read_t(CTStream &strm) {
+  // Raw settings from older savegames
+  if (strm.PeekID_t() != CChunkID("BSET")) {
+    *this = SBotSettings();
+
+    for (INDEX i = 0; i < LEGACY_BOT_SETTINGS; i++) {
+      strm >> FieldValue(*this, *FindSettingField(i));
+    }
+    return;
+  }
+
+  strm.ExpectID_t("BSET"); // Bot SETtings
+
+  INDEX iVersion, iSize;
+  strm >> iVersion >> iSize;
+
+  if (iVersion > BOT_SETTINGS_VERSION || iSize < 0 || iSize > sizeof(CSettingBits().sb_aubData)) {
+    ThrowF_t("Unsupported bot settings (version %d, %d bytes)!", iVersion, iSize);
+  }
+
+  CSettingBits bits;
+  strm.Read_t(bits.sb_aubData, iSize);
+
+  UnpackSettings(*this, bits);
+};
+
+void SBotSettings::Write(CNetworkMessage &nm) const {
+  CSettingBits bits;
+  PackSettings(*this, bits);
+
+  nm.Write("BSET", 4); // Bot SETtings
+  nm << UBYTE(BOT_SETTINGS_VERSION);
+  nm << UWORD(bits.Size());
+  nm.Write(bits.sb_aubData, bits.Size());
+};
+
+void SBotSettings::Read(CNetworkMessage &nm) {
+  // [Cecil] 2026-10-19: Raw settings from older versions start with the first setting instead of the marker
+  char achMarker[4];
+  nm.Read(achMarker, 4);
+
+  if (memcmp(achMarker, "BSET", 4) != 0) {
+    *this = SBotSettings();
+    memcpy(&FieldValue(*this, *FindSettingField(0)), achMarker, 4);
+
+    for (INDEX i = 1; i < LEGACY_BOT_SETTINGS; i++) {
+      nm >> FieldValue(*this, *FindSettingField(i));
+    }
+    return;
+  }
+
+  UBYTE ubVersion;
+  UWORD uwSize;
+  nm >> ubVersion >> uwSize;
+
+  CSettingBits bits;
+  const SLONG slRead = Min(SLONG(uwSize), SLONG(sizeof(bits.sb_aubData)));
+  nm.Read(bits.sb_aubData, slRead);
+
+  // [Cecil] 2026-10-19: Skip settings that don't fit to keep reading the rest of the message
+  SLONG slSkip = SLONG(uwSize) - slRead;
+  UBYTE aubSkip[64];
+
+  while (slSkip > 0) {
+    const SLONG slChunk = Min(slSkip, SLONG(sizeof(aubSkip)));
+    nm.Read(aubSkip, slChunk);
+    slSkip -= slChunk;
+  }
+
+  // Can't unpack settings from newer versions
+  if (ubVersion > BOT_SETTINGS_VERSION) {
+    CPrintF("Unsupported bot settings (version %d, %d bytes)!\n", ubVersion, uwSize);
+    *this = SBotSettings();
+    return;
+  }
+
+  UnpackSettings(*this, bits);
+};
@@ -81,25 +81,35 @@ struct DECL_DLL SBotSettings {
   // Reset settings to a certain difficulty preset
   void Reset(const EDifficulty eDiff);
 
+  // Find difficulty preset with the least amount of different settings
+  EDifficulty ClosestPreset(void) const;
+
+  // [Cecil] 2026-10-19: Write and read only settings that differ from the closest preset
+  void Write_t(CTStream &strm) const;
+  void Read_t(CTStream &strm);
+
+  void Write(CNetworkMessage &nm) const;
+  void Read(CNetworkMessage &nm);
+
   // Stream operations
   friend CTStream &operator<<(CTStream &strm, SBotSettings &sbs) {
-    strm.Write_t(&sbs, sizeof(sbs));
+    sbs.Write_t(strm);
     return strm;
   };
   
   friend CTStream &operator>>(CTStream &strm, SBotSettings &sbs) {
-    strm.Read_t(&sbs, sizeof(sbs));
+    sbs.Read_t(strm);
     return strm;
   };
   
   // Message operations
   friend CNetworkMessage &operator<<(CNetworkMessage &nm, SBotSettings &sbs) {
-    nm.Write(&sbs, sizeof(sbs));
+    sbs.Write(nm);
     return nm;
   };
   
   friend CNetworkMessage &operator>>(CNetworkMessage &nm, SBotSettings &sbs) {
-    nm.Read(&sbs, sizeof(sbs));
+    sbs.Read(nm);
     return nm;
   };
 };
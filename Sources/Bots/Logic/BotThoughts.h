@@ -17,9 +17,60 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #define _CECILBOTS_BOTTHOUGHTS_H
 
 // [Cecil] 2021-06-20: Bot thoughts
+extern INDEX MOD_bBotThoughts;
+
+// Amount of remembered thoughts
+#define BOT_THOUGHTS 16
+
+// [Cecil] 2026-10-19: Types of bot thoughts
+enum EBotThought {
+  BTH_NONE = 0,
+  BTH_GOINGFORITEM,      // item class name
+  BTH_ITEMNOTPICKABLE,
+  BTH_IMPORTANTPOINT,    // point index
+  BTH_REACHEDIMPORTANT,
+  BTH_NEXTIMPORTANT,
+  BTH_CLOSESTPOINT,      // point index, pitch and heading to it
+  BTH_NEXTPOINT,         // point index, pitch and heading to it
+  BTH_STAYINGATPOINT,    // point index, pitch and heading to it
+  BTH_BOTTOMLESSPIT,     // avoiding angle
+  BTH_STOPSHOOTING,
+  BTH_SHOOTFOR,          // shooting time
+};
+
+// [Cecil] 2026-10-19: Thought event that's formatted only when it needs to be displayed
+struct SBotThought {
+  UBYTE bt_ubType; // EBotThought
+  INDEX bt_iArg;
+  FLOAT bt_afArgs[2];
+  const char *bt_strArg; // static string, like a class name
+  TIME bt_tmTick; // when it has been thought of
+
+  // Scale of float arguments that matches their displayed precision
+  inline FLOAT ArgScale(void) const {
+    return (bt_ubType == BTH_SHOOTFOR) ? 100.0f : 10.0f;
+  };
+
+  // Float argument rounded to its displayed precision
+  inline INDEX ArgStep(INDEX iArg) const {
+    return (INDEX)floorf(bt_afArgs[iArg] * ArgScale() + 0.5f);
+  };
+
+  // Check if it's the same thought as it would be displayed
+  inline BOOL SameAs(const SBotThought &bt) const {
+    return bt_ubType == bt.bt_ubType && bt_iArg == bt.bt_iArg && bt_strArg == bt.bt_strArg
+        && ArgStep(0) == bt.ArgStep(0) && ArgStep(1) == bt.ArgStep(1);
+  };
+
+  // Format thought text
+  void Format(CTString &strText) const;
+};
+
+// Fixed ring buffer of recent thoughts
 struct SBotThoughts {
-  CTString strThoughts[16]; // Thoughts
-  CTString strLast; // Last thought text
+  SBotThought aThoughts[BOT_THOUGHTS];
+  INDEX iLast; // slot with the last thought
+  INDEX ctThoughts;
 
   // Constructor
   SBotThoughts(void) {
@@ -28,25 +79,49 @@ struct SBotThoughts {
 
   // Reset thoughts
   void Reset(void) {
-    for (INDEX i = 0; i < 16; i++) {
-      strThoughts[i] = "";
-    }
+    iLast = 0;
+    ctThoughts = 0;
+  };
 
-    strLast = "";
+  // Check if thoughts should be recorded at all
+  static inline BOOL Enabled(void) {
+    return MOD_bBotThoughts;
   };
 
   // Push new thought
-  void Push(const CTString &str) {
-    for (INDEX i = 15; i > 0; i--) {
-      strThoughts[i] = strThoughts[i - 1];
+  void Push(const SBotThought &bt) {
+    // Update the last thought if it's the same
+    if (ctThoughts > 0 && aThoughts[iLast].SameAs(bt)) {
+      aThoughts[iLast].bt_tmTick = bt.bt_tmTick;
+      return;
     }
-    SetLast(str);
+
+    iLast = (iLast + 1) % BOT_THOUGHTS;
+    aThoughts[iLast] = bt;
+    ctThoughts = Min(ctThoughts + 1, (INDEX)BOT_THOUGHTS);
   };
 
-  // Set new last thought
-  void SetLast(const CTString &str) {
-    strThoughts[0].PrintF("[%s] %s", TimeToString(_pTimer->CurrentTick()), str);
-    strLast = str;
+  // Get thought by age (0 is the last one)
+  inline const SBotThought *Get(INDEX iAge) const {
+    if (iAge < 0 || iAge >= ctThoughts) {
+      return NULL;
+    }
+
+    return &aThoughts[(iLast - iAge + BOT_THOUGHTS) % BOT_THOUGHTS];
+  };
+
+  // Format thought by age with its time (empty if there's none)
+  void Format(INDEX iAge, CTString &strText) const {
+    const SBotThought *pbt = Get(iAge);
+
+    if (pbt == NULL) {
+      strText = "";
+      return;
+    }
+
+    CTString strThought;
+    pbt->Format(strThought);
+    strText.PrintF("[%s] %s", TimeToString(pbt->bt_tmTick), strThought);
   };
 };
 
@@ -61,6 +61,368 @@ extern const SBotWeaponConfig _abwCooperativeWeapons[CT_BOT_WEAPONS] = {
   { WEAPON_NONE,             0.0f,    0.0f,    0.0f,  0.00f,   0.00f,  NO_SPEC,  NO_FREQ}, // 0
 };
 
+// [Cecil] 2026-10-19: Weapon tables for deathmatch and cooperative
+SBotWeaponTable _bwtDeathmatchWeapons;
+SBotWeaponTable _bwtCooperativeWeapons;
+
+// [Cecil] 2026-10-19: Rate weapon against an enemy at some distance (0 if out of range)
+FLOAT RateBotWeapon(const SBotWeaponConfig &bw, FLOAT fDist) {
+  // Check if distance is okay
+  if (fDist > bw.bw_fMaxDistance || fDist < bw.bw_fMinDistance) {
+    return 0.0f;
+  }
+
+  FLOAT fDistRatio = (fDist - bw.bw_fMinDistance) / (bw.bw_fMaxDistance - bw.bw_fMinDistance); // From min to max [0 .. 1]
+  FLOAT fMul = bw.bw_fAccuracy + (1 - bw.bw_fAccuracy) * (1 - fDistRatio); // From min to max [fAccuracy .. 1]
+
+  FLOAT fRating = bw.bw_fDamage * fMul;
+
+  // Empty range
+  if (!(fRating > 0.0f)) {
+    return 0.0f;
+  }
+
+  return fRating;
+};
+
+// [Cecil] 2026-10-19: Pick the best weapon by rating every weapon in the config (-1 if none)
+INDEX PickBotWeaponDirectly(const SBotWeaponConfig *aConfig, FLOAT fDist, ULONG ulUsable) {
+  INDEX iSelect = -1;
+  FLOAT fLastDamage = 0.0f;
+
+  for (INDEX iWeapon = 0; iWeapon < CT_BOT_WEAPONS; iWeapon++) {
+    const INDEX iType = aConfig[iWeapon].bw_iType;
+
+    if (iType == WPN_NOTHING || !(ulUsable & WPN_FLAG(iType))) {
+      continue;
+    }
+
+    const FLOAT fRating = RateBotWeapon(aConfig[iWeapon], fDist);
+
+    // Better than the last one
+    if (fLastDamage < fRating) {
+      iSelect = iWeapon;
+      fLastDamage = fRating;
+    }
+  }
+
+  return iSelect;
+};
+
+// Weapon rating for sorting
+struct SRatedWeapon {
+  INDEX iWeapon;
+  FLOAT fRating;
+};
+
+static int qsort_CompareRatedWeapons(const void *pv0, const void *pv1) {
+  const SRatedWeapon &rw0 = *(const SRatedWeapon *)pv0;
+  const SRatedWeapon &rw1 = *(const SRatedWeapon *)pv1;
+
+  // Better weapons first
+  if (rw0.fRating > rw1.fRating) return -1;
+  if (rw0.fRating < rw1.fRating) return +1;
+
+  // Weapons with the same rating in the config order
+  if (rw0.iWeapon < rw1.iWeapon) return -1;
+  if (rw0.iWeapon > rw1.iWeapon) return +1;
+  return 0;
+};
+
+static int qsort_CompareBreaks(const void *pv0, const void *pv1) {
+  const FLOAT f0 = *(const FLOAT *)pv0;
+  const FLOAT f1 = *(const FLOAT *)pv1;
+
+  if (f0 < f1) return -1;
+  if (f0 > f1) return +1;
+  return 0;
+};
+
+// [Cecil] 2026-10-19: Compile the table from a weapon config
+void SBotWeaponTable::Compile(const SBotWeaponConfig *aConfig) {
+  bwt_aConfig = aConfig;
+  bwt_iDefault = -1;
+
+  bwt_afBreaks.PopAll();
+  bwt_aiSteps.PopAll();
+  bwt_aiFirst.PopAll();
+  bwt_aiCandidates.PopAll();
+
+  INDEX iWeapon;
+
+  for (iWeapon = 0; iWeapon < CT_BOT_WEAPONS; iWeapon++) {
+    if (aConfig[iWeapon].bw_iType == WPN_DEFAULT_1) {
+      bwt_iDefault = iWeapon;
+      break;
+    }
+  }
+
+  // Ratings change their order at range limits and where they cross each other
+  CStaticStackArray<FLOAT> afBreaks;
+
+  for (iWeapon = 0; iWeapon < CT_BOT_WEAPONS; iWeapon++) {
+    const SBotWeaponConfig &bw = aConfig[iWeapon];
+
+    if (bw.bw_iType == WPN_NOTHING) continue;
+
+    afBreaks.Push() = bw.bw_fMinDistance;
+    afBreaks.Push() = bw.bw_fMaxDistance;
+
+    if (bw.bw_fMaxDistance <= bw.bw_fMinDistance) continue;
+
+    // Rating is a line over the range
+    const FLOAT fSlope = -bw.bw_fDamage * (1 - bw.bw_fAccuracy) / (bw.bw_fMaxDistance - bw.bw_fMinDistance);
+    const FLOAT fBase = bw.bw_fDamage - fSlope * bw.bw_fMinDistance;
+
+    for (INDEX iOther = iWeapon + 1; iOther < CT_BOT_WEAPONS; iOther++) {
+      const SBotWeaponConfig &bwOther = aConfig[iOther];
+
+      if (bwOther.bw_iType == WPN_NOTHING || bwOther.bw_fMaxDistance <= bwOther.bw_fMinDistance) continue;
+
+      const FLOAT fOtherSlope = -bwOther.bw_fDamage * (1 - bwOther.bw_fAccuracy) / (bwOther.bw_fMaxDistance - bwOther.bw_fMinDistance);
+      const FLOAT fOtherBase = bwOther.bw_fDamage - fOtherSlope * bwOther.bw_fMinDistance;
+
+      // Parallel lines
+      if (fSlope == fOtherSlope) continue;
+
+      const FLOAT fCross = (fOtherBase - fBase) / (fSlope - fOtherSlope);
+
+      // Only within both ranges
+      if (fCross > Max(bw.bw_fMinDistance, bwOther.bw_fMinDistance) && fCross < Min(bw.bw_fMaxDistance, bwOther.bw_fMaxDistance)) {
+        afBreaks.Push() = fCross;
+      }
+    }
+  }
+
+  // Sort breaks and remove duplicates
+  const INDEX ctAllBreaks = afBreaks.Count();
+
+  if (ctAllBreaks > 0) {
+    qsort(&afBreaks[0], ctAllBreaks, sizeof(FLOAT), qsort_CompareBreaks);
+  }
+
+  for (INDEX iBreak = 0; iBreak < ctAllBreaks; iBreak++) {
+    if (iBreak == 0 || afBreaks[iBreak] != afBreaks[iBreak - 1]) {
+      bwt_afBreaks.Push() = afBreaks[iBreak];
+    }
+  }
+
+  const INDEX ctBreaks = bwt_afBreaks.Count();
+
+  // Ranges before each break, at each break and after the last one
+  const INDEX ctRanges = ctBreaks * 2 + 1;
+  SRatedWeapon arwRated[CT_BOT_WEAPONS];
+
+  for (INDEX iRange = 0; iRange < ctRanges; iRange++) {
+    const INDEX iBreak = iRange / 2;
+    FLOAT fDist;
+
+    // Exactly at the break
+    if (iRange % 2 == 1) {
+      fDist = bwt_afBreaks[iBreak];
+
+    // Before the first break
+    } else if (iBreak == 0) {
+      fDist = (ctBreaks > 0 ? bwt_afBreaks[0] - 1.0f : 0.0f);
+
+    // After the last break
+    } else if (iBreak == ctBreaks) {
+      fDist = bwt_afBreaks[ctBreaks - 1] + 1.0f;
+
+    // Between two breaks
+    } else {
+      fDist = (bwt_afBreaks[iBreak - 1] + bwt_afBreaks[iBreak]) * 0.5f;
+    }
+
+    INDEX ctRated = 0;
+
+    for (iWeapon = 0; iWeapon < CT_BOT_WEAPONS; iWeapon++) {
+      if (aConfig[iWeapon].bw_iType == WPN_NOTHING) continue;
+
+      const FLOAT fRating = RateBotWeapon(aConfig[iWeapon], fDist);
+
+      if (fRating > 0.0f) {
+        arwRated[ctRated].iWeapon = iWeapon;
+        arwRated[ctRated].fRating = fRating;
+        ctRated++;
+      }
+    }
+
+    if (ctRated > 1) {
+      qsort(arwRated, ctRated, sizeof(SRatedWeapon), qsort_CompareRatedWeapons);
+    }
+
+    bwt_aiFirst.Push() = bwt_aiCandidates.Count();
+
+    for (INDEX iRated = 0; iRated < ctRated; iRated++) {
+      bwt_aiCandidates.Push() = arwRated[iRated].iWeapon;
+    }
+  }
+
+  bwt_aiFirst.Push() = bwt_aiCandidates.Count();
+
+  // Amount of breaks before each distance step
+  const INDEX ctSteps = (ctBreaks > 0 ? INDEX(bwt_afBreaks[ctBreaks - 1] / WEAPON_TABLE_STEP) : 0) + 1;
+  INDEX iBreak = 0;
+
+  for (INDEX iStep = 0; iStep < ctSteps; iStep++) {
+    const FLOAT fStep = iStep * WEAPON_TABLE_STEP;
+
+    while (iBreak < ctBreaks && bwt_afBreaks[iBreak] < fStep) {
+      iBreak++;
+    }
+
+    bwt_aiSteps.Push() = iBreak;
+  }
+};
+
+// [Cecil] 2026-10-19: Get range of distances that some distance belongs to
+INDEX SBotWeaponTable::Range(FLOAT fDist) const {
+  const INDEX ctBreaks = bwt_afBreaks.Count();
+  INDEX iBreak = 0;
+
+  // Skip breaks before the distance step
+  if (fDist > 0.0f) {
+    const INDEX iStep = Min(INDEX(fDist / WEAPON_TABLE_STEP), bwt_aiSteps.Count() - 1);
+    iBreak = bwt_aiSteps[iStep];
+  }
+
+  while (iBreak < ctBreaks && bwt_afBreaks[iBreak] < fDist) {
+    iBreak++;
+  }
+
+  // Exactly at the break
+  if (iBreak < ctBreaks && bwt_afBreaks[iBreak] == fDist) {
+    return iBreak * 2 + 1;
+  }
+
+  return iBreak * 2;
+};
+
+// [Cecil] 2026-10-19: Check if weapons in some range need to be rated again at this distance
+BOOL SBotWeaponTable::NearBreak(FLOAT fDist, INDEX iRange) const {
+  // Exactly at the break
+  if (iRange % 2 == 1) {
+    return TRUE;
+  }
+
+  // Ratings that cross each other might be rounded differently close to the break
+  const INDEX iBreak = iRange / 2;
+
+  if (iBreak > 0 && fDist - bwt_afBreaks[iBreak - 1] < WEAPON_TABLE_TOLERANCE) {
+    return TRUE;
+  }
+
+  if (iBreak < bwt_afBreaks.Count() && bwt_afBreaks[iBreak] - fDist < WEAPON_TABLE_TOLERANCE) {
+    return TRUE;
+  }
+
+  return FALSE;
+};
+
+// [Cecil] 2026-10-19: Pick the best weapon from a set of usable weapon types (-1 if none)
+INDEX SBotWeaponTable::Pick(FLOAT fDist, ULONG ulUsable) const {
+  const INDEX iRange = Range(fDist);
+  const BOOL bRate = NearBreak(fDist, iRange);
+
+  INDEX iSelect = -1;
+  FLOAT fLastDamage = 0.0f;
+
+  for (INDEX iCandidate = bwt_aiFirst[iRange]; iCandidate < bwt_aiFirst[iRange + 1]; iCandidate++) {
+    const INDEX iWeapon = bwt_aiCandidates[iCandidate];
+
+    if (!(ulUsable & WPN_FLAG(bwt_aConfig[iWeapon].bw_iType))) {
+      continue;
+    }
+
+    // First usable weapon is the best one
+    if (!bRate) {
+      return iWeapon;
+    }
+
+    // Pick the first one in the config out of the best ones
+    const FLOAT fRating = RateBotWeapon(bwt_aConfig[iWeapon], fDist);
+
+    if (fLastDamage < fRating || (fLastDamage == fRating && iWeapon < iSelect)) {
+      iSelect = iWeapon;
+      fLastDamage = fRating;
+    }
+  }
+
+  return iSelect;
+};
+
+// [Cecil] 2026-10-19: Compile weapon tables for all game modes
+void CECIL_CompileWeaponTables(void) {
+  _bwtDeathmatchWeapons.Compile(_abwDeathmatchWeapons);
+  _bwtCooperativeWeapons.Compile(_abwCooperativeWeapons);
+};
+
+// [Cecil] 2026-10-19: Compare weapon tables against rating every weapon at many distances
+void CECIL_WeaponTableCheck(INDEX ctMasks) {
+  ctMasks = ClampDn(ctMasks, (INDEX)1);
+
+  const SBotWeaponTable *apbwtTables[2] = { &_bwtDeathmatchWeapons, &_bwtCooperativeWeapons };
+  const char *astrTables[2] = { "Deathmatch", "Cooperative" };
+
+  ULONG ulSeed = 0x5EED;
+  INDEX ctTotalMismatches = 0;
+
+  for (INDEX iTable = 0; iTable < 2; iTable++) {
+    const SBotWeaponTable &bwt = *apbwtTables[iTable];
+    INDEX ctChecks = 0;
+    INDEX ctMismatches = 0;
+
+    // Distances in small steps and around each break
+    CStaticStackArray<FLOAT> afDists;
+
+    for (INDEX iDist = 0; iDist <= 60000; iDist++) {
+      afDists.Push() = iDist * 0.01f;
+    }
+
+    for (INDEX iBreak = 0; iBreak < bwt.bwt_afBreaks.Count(); iBreak++) {
+      afDists.Push() = bwt.bwt_afBreaks[iBreak] - 0.001f;
+      afDists.Push() = bwt.bwt_afBreaks[iBreak];
+      afDists.Push() = bwt.bwt_afBreaks[iBreak] + 0.001f;
+    }
+
+    for (INDEX iMask = 0; iMask < ctMasks; iMask++) {
+      // All weapons first, then random sets
+      ULONG ulUsable = 0xFFFFFFFF;
+
+      if (iMask > 0) {
+        ulSeed = ulSeed * 1103515245 + 12345;
+        ulUsable = (ulSeed >> 8);
+      }
+
+      for (INDEX iDist = 0; iDist < afDists.Count(); iDist++) {
+        const INDEX iPicked = bwt.Pick(afDists[iDist], ulUsable);
+        const INDEX iDirect = PickBotWeaponDirectly(bwt.bwt_aConfig, afDists[iDist], ulUsable);
+
+        if (iPicked != iDirect) {
+          // Report the first few
+          if (ctMismatches < 8) {
+            CPrintF("  %.3f m (0x%08X): table %d, direct %d\n", afDists[iDist], ulUsable, iPicked, iDirect);
+          }
+          ctMismatches++;
+        }
+        ctChecks++;
+      }
+    }
+
+    CPrintF("%s weapons: %d breaks, %d candidates, %d mismatches in %d checks\n", astrTables[iTable],
+      bwt.bwt_afBreaks.Count(), bwt.bwt_aiCandidates.Count(), ctMismatches, ctChecks);
+
+    ctTotalMismatches += ctMismatches;
+  }
+
+  if (ctTotalMismatches == 0) {
+    CPrintF("^c00ff00PASS^r: weapon tables pick the same weapons as rating them directly\n");
+  } else {
+    CPrintF("^cff0000FAIL^r: %d picks differ from rating weapons directly\n", ctTotalMismatches);
+  }
+};
+
 // Currently zooming in with a scope or not
 BOOL CPlayerBotController::UsingScope(void) {
   return GetWeapons()->m_bSniping;
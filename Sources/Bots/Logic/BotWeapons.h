@@ -48,6 +48,62 @@ inline const SBotWeaponConfig *PickWeaponConfig(void) {
   return _abwDeathmatchWeapons;
 };
 
+// [Cecil] 2026-10-19: Distance step for the quick lookup in weapon tables
+#define WEAPON_TABLE_STEP 4.0f
+
+// [Cecil] 2026-10-19: How close to a break weapons need to be rated again because of rounding errors
+#define WEAPON_TABLE_TOLERANCE 0.01f
+
+// [Cecil] 2026-10-19: Weapons sorted by their rating within each range of distances
+struct SBotWeaponTable {
+  const SBotWeaponConfig *bwt_aConfig; // weapon config that the table has been compiled from
+  INDEX bwt_iDefault; // index of the default weapon in the config
+
+  CStaticStackArray<FLOAT> bwt_afBreaks; // distances at which weapon ratings change their order
+  CStaticStackArray<INDEX> bwt_aiSteps;  // amount of breaks before each distance step
+  CStaticStackArray<INDEX> bwt_aiFirst;  // first candidate for each range (with one extra at the end)
+  CStaticStackArray<INDEX> bwt_aiCandidates; // weapons in the config from best to worst
+
+  // Constructor
+  SBotWeaponTable(void) : bwt_aConfig(NULL), bwt_iDefault(-1) {};
+
+  // Compile the table from a weapon config
+  void Compile(const SBotWeaponConfig *aConfig);
+
+  // Get range of distances that some distance belongs to
+  INDEX Range(FLOAT fDist) const;
+
+  // Check if weapons in some range need to be rated again at this distance
+  BOOL NearBreak(FLOAT fDist, INDEX iRange) const;
+
+  // Pick the best weapon from a set of usable weapon types (-1 if none)
+  INDEX Pick(FLOAT fDist, ULONG ulUsable) const;
+};
+
+// [Cecil] 2026-10-19: Weapon tables for deathmatch and cooperative
+extern SBotWeaponTable _bwtDeathmatchWeapons;
+extern SBotWeaponTable _bwtCooperativeWeapons;
+
+// [Cecil] 2026-10-19: Compile weapon tables for all game modes
+void CECIL_CompileWeaponTables(void);
+
+// [Cecil] 2026-10-19: Pick weapon table
+inline const SBotWeaponTable *PickWeaponTable(void) {
+  if (IsCoopGame()) {
+    return &_bwtCooperativeWeapons;
+  }
+  return &_bwtDeathmatchWeapons;
+};
+
+// [Cecil] 2026-10-19: Rate weapon against an enemy at some distance (0 if out of range)
+FLOAT RateBotWeapon(const SBotWeaponConfig &bw, FLOAT fDist);
+
+// [Cecil] 2026-10-19: Pick the best weapon by rating every weapon in the config (-1 if none)
+INDEX PickBotWeaponDirectly(const SBotWeaponConfig *aConfig, FLOAT fDist, ULONG ulUsable);
+
+// [Cecil] 2026-10-19: Compare weapon tables against rating every weapon at many distances
+DECL_DLL void CECIL_WeaponTableCheck(INDEX ctMasks);
+
 // --- Customizable helper functions
 
 // Default weapons
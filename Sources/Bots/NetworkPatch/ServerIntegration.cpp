@@ -18,6 +18,7 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 
 #include "Bots/Patcher/patcher.h"
 #include "Bots/CustomPackets.h"
+#include "Bots/PathFinding/NavmeshLoader.h"
 
 // Server patches
 class CCecilMessageDispatcher : public CMessageDispatcher {
@@ -118,9 +119,25 @@ void CCecilSessionState::P_ProcessGameStreamBlock(CNetworkMessage &nmMessage) {
   // Copy the tick to process into tick used for all tasks
   _pTimer->SetCurrentTick(ses_tmLastProcessedTick);
 
+  // [Cecil] 2026-10-19: Game tick
+  const BOOL bTick = (nmMessage.GetType() == MSG_SEQ_ALLACTIONS);
+
+  // [Cecil] 2026-10-19: Add queued bots at the beginning of each game tick
+  if (bTick) {
+    CECIL_BotBenchmarkTickStart();
+    CECIL_ProcessBotQueue();
+
+    // [Cecil] 2026-10-19: Send NavMesh that has been read in the background
+    _nlNavmesh.Update();
+  }
+
   // If cannot handle custom packet
   if (HandleCustomPacket(this, nmMessage)) {
     // Call the original function for standard packets
     (this->*pProcGameStreamBlock)(nmMessage);
   }
+
+  if (bTick) {
+    CECIL_BotBenchmarkTickEnd();
+  }
 };
@@ -0,0 +1,710 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#include "StdH.h"
+#include "FlowField.h"
+#include "Navmesh.h"
+
+// Constructor
+CFlowField::CFlowField(void) {
+  ff_pbppTarget = NULL;
+  ff_ulLockRevision = 0;
+  ff_ulLastUse = 0;
+};
+
+// Forget the field
+void CFlowField::Clear(void) {
+  ff_pbppTarget = NULL;
+  ff_ulLockRevision = 0;
+  ff_ulLastUse = 0;
+  ff_aiNext.Clear();
+};
+
+// Constructor
+CFlowFields::CFlowFields(void) {
+  ffs_ulRevision = 0;
+  ffs_bGraph = FALSE;
+  ffs_ulUses = 0;
+  ffs_ctBuilt = 0;
+};
+
+// Forget the graph and all fields
+void CFlowFields::Clear(void) {
+  ffs_bGraph = FALSE;
+  ffs_apbppPoints.Clear();
+  ffs_aSorted.Clear();
+  ffs_aiFirstLink.Clear();
+  ffs_aiLinkFrom.Clear();
+  ffs_afLinkCost.Clear();
+
+  for (INDEX iField = 0; iField < CT_FLOW_FIELDS; iField++) {
+    ffs_affFields[iField].Clear();
+  }
+
+  ffs_ulUses = 0;
+};
+
+static int qsort_CompareFlowPoints(const void *pv0, const void *pv1) {
+  const SFlowPoint &fp0 = *(const SFlowPoint *)pv0;
+  const SFlowPoint &fp1 = *(const SFlowPoint *)pv1;
+
+  if (size_t(fp0.pbpp) < size_t(fp1.pbpp)) return -1;
+  if (size_t(fp0.pbpp) > size_t(fp1.pbpp)) return +1;
+  return 0;
+};
+
+// Find index of a point in the graph (-1 if not found)
+INDEX CFlowFields::PointIndex(CBotPathPoint *pbpp) const {
+  INDEX iMin = 0;
+  INDEX iMax = ffs_aSorted.Count() - 1;
+
+  while (iMin <= iMax) {
+    const INDEX iMid = (iMin + iMax) / 2;
+    const SFlowPoint &fp = ffs_aSorted[iMid];
+
+    if (fp.pbpp == pbpp) {
+      return fp.iPoint;
+    }
+
+    if (size_t(fp.pbpp) < size_t(pbpp)) {
+      iMin = iMid + 1;
+    } else {
+      iMax = iMid - 1;
+    }
+  }
+
+  return -1;
+};
+
+// Prepare the graph for the current state of the NavMesh (optionally without updating lock states)
+void CFlowFields::Update(CBotNavmesh &bnm, BOOL bUpdateLocks) {
+  // Lock states for this tick
+  if (bUpdateLocks) {
+    bnm.UpdateLocks();
+  }
+
+  UpdateGraph(bnm);
+};
+
+// Rebuild the point graph if NavMesh points have been changed
+void CFlowFields::UpdateGraph(CBotNavmesh &bnm) {
+  if (!ffs_bGraph || ffs_ulRevision != bnm.bnm_ulRevision) {
+    BuildGraph(bnm);
+  }
+};
+
+// Rebuild the point graph from the NavMesh
+void CFlowFields::BuildGraph(CBotNavmesh &bnm) {
+  Clear();
+
+  ffs_bGraph = TRUE;
+  ffs_ulRevision = bnm.bnm_ulRevision;
+
+  const INDEX ctPoints = bnm.bnm_aPoints.Count();
+
+  if (ctPoints <= 0) {
+    return;
+  }
+
+  ffs_apbppPoints.New(ctPoints);
+  ffs_aSorted.New(ctPoints);
+
+  INDEX iPoint;
+
+  for (iPoint = 0; iPoint < ctPoints; iPoint++) {
+    CBotPathPoint *pbpp = bnm.bnm_aPoints.Pointer(iPoint);
+    ffs_apbppPoints[iPoint] = pbpp;
+
+    ffs_aSorted[iPoint].pbpp = pbpp;
+    ffs_aSorted[iPoint].iPoint = iPoint;
+  }
+
+  qsort(&ffs_aSorted[0], ctPoints, sizeof(SFlowPoint), qsort_CompareFlowPoints);
+
+  // Count connections to each point
+  ffs_aiFirstLink.New(ctPoints + 1);
+
+  for (iPoint = 0; iPoint <= ctPoints; iPoint++) {
+    ffs_aiFirstLink[iPoint] = 0;
+  }
+
+  for (iPoint = 0; iPoint < ctPoints; iPoint++) {
+    FOREACHINDYNAMICCONTAINER(ffs_apbppPoints[iPoint]->bpp_cbppPoints, CBotPathPoint, itbpp) {
+      const INDEX iTarget = PointIndex(itbpp);
+
+      if (iTarget != -1) {
+        ffs_aiFirstLink[iTarget + 1]++;
+      }
+    }
+  }
+
+  for (iPoint = 0; iPoint < ctPoints; iPoint++) {
+    ffs_aiFirstLink[iPoint + 1] += ffs_aiFirstLink[iPoint];
+  }
+
+  const INDEX ctLinks = ffs_aiFirstLink[ctPoints];
+
+  if (ctLinks <= 0) {
+    return;
+  }
+
+  ffs_aiLinkFrom.New(ctLinks);
+  ffs_afLinkCost.New(ctLinks);
+
+  // Fill connections to each point in the NavMesh order
+  CStaticArray<INDEX> aiFill;
+  aiFill.New(ctPoints);
+
+  for (iPoint = 0; iPoint < ctPoints; iPoint++) {
+    aiFill[iPoint] = ffs_aiFirstLink[iPoint];
+  }
+
+  for (iPoint = 0; iPoint < ctPoints; iPoint++) {
+    CBotPathPoint *pbpp = ffs_apbppPoints[iPoint];
+
+    FOREACHINDYNAMICCONTAINER(pbpp->bpp_cbppPoints, CBotPathPoint, itbpp) {
+      CBotPathPoint *pbppTarget = itbpp;
+      const INDEX iTarget = PointIndex(pbppTarget);
+
+      if (iTarget == -1) continue;
+
+      const INDEX iLink = aiFill[iTarget]++;
+      ffs_aiLinkFrom[iLink] = iPoint;
+
+      // Teleports have no distance to any target point
+      if (pbpp->bpp_ulFlags & PPF_TELEPORT) {
+        ffs_afLinkCost[iLink] = 0.0f;
+      } else {
+        ffs_afLinkCost[iLink] = (pbppTarget->bpp_vPos - pbpp->bpp_vPos).Length();
+      }
+    }
+  }
+};
+
+// Point in the queue of the flow field search
+struct SFlowNode {
+  FLOAT fDist;
+  INDEX iPoint;
+};
+
+// Binary heaps of points with the closest one on top
+static CStaticStackArray<SFlowNode> _aFlowHeap;
+static CStaticStackArray<SFlowNode> _aRouteHeap;
+
+// Distances and next points of the last route search
+static CStaticArray<FLOAT> _afRouteDist;
+static CStaticArray<INDEX> _aiRouteNext;
+
+// Point flags for the route search
+#define RPF_SOURCE   (1 << 0) // search stops once all sources are reached
+#define RPF_PASSABLE (1 << 1) // can be passed through even if it's locked
+
+static CStaticArray<UBYTE> _aubRouteFlags;
+
+static inline BOOL FlowNodeCloser(const SFlowNode &fn0, const SFlowNode &fn1) {
+  // Same distances are resolved by point order for the same results on every machine
+  return fn0.fDist < fn1.fDist || (fn0.fDist == fn1.fDist && fn0.iPoint < fn1.iPoint);
+};
+
+static void PushFlowNode(CStaticStackArray<SFlowNode> &aHeap, FLOAT fDist, INDEX iPoint) {
+  INDEX iNode = aHeap.Count();
+
+  SFlowNode &fnNew = aHeap.Push();
+  fnNew.fDist = fDist;
+  fnNew.iPoint = iPoint;
+
+  const SFlowNode fn = fnNew;
+
+  while (iNode > 0) {
+    const INDEX iParent = (iNode - 1) / 2;
+
+    if (!FlowNodeCloser(fn, aHeap[iParent])) break;
+
+    aHeap[iNode] = aHeap[iParent];
+    iNode = iParent;
+  }
+
+  aHeap[iNode] = fn;
+};
+
+static SFlowNode PopFlowNode(CStaticStackArray<SFlowNode> &aHeap) {
+  const SFlowNode fnTop = aHeap[0];
+  const SFlowNode fnLast = aHeap.Pop();
+
+  const INDEX ctNodes = aHeap.Count();
+
+  if (ctNodes > 0) {
+    INDEX iNode = 0;
+
+    FOREVER {
+      INDEX iChild = iNode * 2 + 1;
+
+      if (iChild >= ctNodes) break;
+
+      if (iChild + 1 < ctNodes && FlowNodeCloser(aHeap[iChild + 1], aHeap[iChild])) {
+        iChild++;
+      }
+
+      if (!FlowNodeCloser(aHeap[iChild], fnLast)) break;
+
+      aHeap[iNode] = aHeap[iChild];
+      iNode = iChild;
+    }
+
+    aHeap[iNode] = fnLast;
+  }
+
+  return fnTop;
+};
+
+// Build a field towards some point
+void CFlowFields::BuildField(CFlowField &ff, CBotPathPoint *pbppTarget, ULONG ulLockRevision) {
+  ffs_ctBuilt++;
+
+  ff.ff_pbppTarget = pbppTarget;
+  ff.ff_ulLockRevision = ulLockRevision;
+
+  const INDEX ctPoints = ffs_apbppPoints.Count();
+
+  if (ff.ff_aiNext.Count() != ctPoints) {
+    ff.ff_aiNext.Clear();
+
+    if (ctPoints > 0) {
+      ff.ff_aiNext.New(ctPoints);
+    }
+  }
+
+  const INDEX iTarget = PointIndex(pbppTarget);
+
+  if (iTarget == -1) {
+    for (INDEX iPoint = 0; iPoint < ctPoints; iPoint++) {
+      ff.ff_aiNext[iPoint] = -1;
+    }
+    return;
+  }
+
+  // Distances to the target (negative if not reached yet)
+  CStaticArray<FLOAT> afDist;
+  afDist.New(ctPoints);
+
+  for (INDEX iPoint = 0; iPoint < ctPoints; iPoint++) {
+    ff.ff_aiNext[iPoint] = -1;
+    afDist[iPoint] = -1.0f;
+  }
+
+  // Go backwards from the target through all connections that lead to it
+  _aFlowHeap.PopAll();
+
+  afDist[iTarget] = 0.0f;
+  PushFlowNode(_aFlowHeap, 0.0f, iTarget);
+
+  while (_aFlowHeap.Count() > 0) {
+    const SFlowNode fn = PopFlowNode(_aFlowHeap);
+
+    // Already reached this point in a shorter way
+    if (fn.fDist > afDist[fn.iPoint]) {
+      continue;
+    }
+
+    _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_ASTAR_EXPANSIONS);
+
+    // Can't go through locked points
+    if (ffs_apbppPoints[fn.iPoint]->IsLocked()) {
+      continue;
+    }
+
+    for (INDEX iLink = ffs_aiFirstLink[fn.iPoint]; iLink < ffs_aiFirstLink[fn.iPoint + 1]; iLink++) {
+      const INDEX iFrom = ffs_aiLinkFrom[iLink];
+      const FLOAT fDist = fn.fDist + ffs_afLinkCost[iLink];
+
+      if (afDist[iFrom] < 0.0f || fDist < afDist[iFrom]) {
+        afDist[iFrom] = fDist;
+        ff.ff_aiNext[iFrom] = fn.iPoint;
+
+        PushFlowNode(_aFlowHeap, fDist, iFrom);
+      }
+    }
+  }
+
+  // Target itself has nowhere to go
+  ff.ff_aiNext[iTarget] = -1;
+};
+
+// Reset route search data for the current point graph
+void CFlowFields::PrepareRoute(void) {
+  const INDEX ctPoints = ffs_apbppPoints.Count();
+
+  if (_afRouteDist.Count() != ctPoints) {
+    _afRouteDist.Clear();
+    _aiRouteNext.Clear();
+    _aubRouteFlags.Clear();
+
+    if (ctPoints > 0) {
+      _afRouteDist.New(ctPoints);
+      _aiRouteNext.New(ctPoints);
+      _aubRouteFlags.New(ctPoints);
+    }
+  }
+
+  for (INDEX iPoint = 0; iPoint < ctPoints; iPoint++) {
+    _afRouteDist[iPoint] = -1.0f;
+    _aiRouteNext[iPoint] = -1;
+    _aubRouteFlags[iPoint] = 0;
+  }
+};
+
+// Search backwards from the target until all marked sources are reached, like for a field (marked passable points can be locked)
+void CFlowFields::SearchRoute(INDEX iDst, INDEX ctSources) {
+  // Points are visited in the same order as when building a field,
+  // so the sources get the same next points as they would in the whole field
+  _aRouteHeap.PopAll();
+
+  _afRouteDist[iDst] = 0.0f;
+  PushFlowNode(_aRouteHeap, 0.0f, iDst);
+
+  INDEX ctReached = 0;
+
+  while (_aRouteHeap.Count() > 0) {
+    const SFlowNode fn = PopFlowNode(_aRouteHeap);
+
+    if (fn.fDist > _afRouteDist[fn.iPoint]) {
+      continue;
+    }
+
+    const UBYTE ubFlags = _aubRouteFlags[fn.iPoint];
+
+    // Nothing can change the paths from the sources anymore
+    if (ubFlags & RPF_SOURCE) {
+      ctReached++;
+
+      if (ctReached >= ctSources) {
+        break;
+      }
+    }
+
+    _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_ASTAR_EXPANSIONS);
+
+    // Can't go through locked points
+    if (!(ubFlags & RPF_PASSABLE) && ffs_apbppPoints[fn.iPoint]->IsLocked()) {
+      continue;
+    }
+
+    for (INDEX iLink = ffs_aiFirstLink[fn.iPoint]; iLink < ffs_aiFirstLink[fn.iPoint + 1]; iLink++) {
+      const INDEX iFrom = ffs_aiLinkFrom[iLink];
+      const FLOAT fDist = fn.fDist + ffs_afLinkCost[iLink];
+
+      if (_afRouteDist[iFrom] < 0.0f || fDist < _afRouteDist[iFrom]) {
+        _afRouteDist[iFrom] = fDist;
+        _aiRouteNext[iFrom] = fn.iPoint;
+
+        PushFlowNode(_aRouteHeap, fDist, iFrom);
+      }
+    }
+  }
+
+  // Target itself has nowhere to go
+  _aiRouteNext[iDst] = -1;
+};
+
+// Find next point on the shortest path from one point to another
+// Fields are only built for targets that more than one bot is going to, otherwise only the path from the source is searched
+CBotPathPoint *CFlowFields::NextPoint(CBotNavmesh &bnm, CBotPathPoint *pbppSrc, CBotPathPoint *pbppDst, INDEX ctRequesters, BOOL bUpdateLocks) {
+  // No points at all
+  if (pbppSrc == NULL || pbppDst == NULL) {
+    return NULL;
+  }
+
+  Update(bnm, bUpdateLocks);
+
+  const INDEX iSrc = PointIndex(pbppSrc);
+
+  if (iSrc == -1) {
+    return NULL;
+  }
+
+  ffs_ulUses++;
+
+  // Find field towards the target or replace the one that hasn't been used the longest
+  CFlowField *pffTarget = NULL;
+  CFlowField *pffOldest = &ffs_affFields[0];
+
+  for (INDEX iField = 0; iField < CT_FLOW_FIELDS; iField++) {
+    CFlowField &ff = ffs_affFields[iField];
+
+    if (ff.ff_pbppTarget == pbppDst) {
+      pffTarget = &ff;
+      break;
+    }
+
+    if (ff.ff_ulLastUse < pffOldest->ff_ulLastUse) {
+      pffOldest = &ff;
+    }
+  }
+
+  // Only one bot is going there, so a whole field won't be reused and would push out fields of other targets
+  if (pffTarget == NULL && ctRequesters <= 1) {
+    const INDEX iDst = PointIndex(pbppDst);
+
+    if (iDst == -1) {
+      return NULL;
+    }
+
+    PrepareRoute();
+    _aubRouteFlags[iSrc] |= RPF_SOURCE;
+
+    SearchRoute(iDst, 1);
+
+    const INDEX iNext = _aiRouteNext[iSrc];
+    return (iNext != -1) ? ffs_apbppPoints[iNext] : NULL;
+  }
+
+  // Rebuild the field for a new target or if some lock has changed
+  if (pffTarget == NULL) {
+    pffTarget = pffOldest;
+    BuildField(*pffTarget, pbppDst, bnm.bnm_ulLockRevision);
+
+  } else if (pffTarget->ff_ulLockRevision != bnm.bnm_ulLockRevision) {
+    BuildField(*pffTarget, pbppDst, bnm.bnm_ulLockRevision);
+  }
+
+  pffTarget->ff_ulLastUse = ffs_ulUses;
+
+  const INDEX iNext = pffTarget->ff_aiNext[iSrc];
+  return (iNext != -1) ? ffs_apbppPoints[iNext] : NULL;
+};
+
+// Check for each source if the shortest path towards some point goes through any of the points that have just changed their lock states
+// Changed points are considered passable (even if they're locked), so paths that have just been blocked or opened are both found
+void CFlowFields::RoutesThrough(CBotNavmesh &bnm, CBotPathPoint *pbppDst, CBotPathPoint **apbppSrc, BOOL *abThrough, INDEX ctSrc,
+                                CBotPathPoint **apbppChanged, INDEX ctChanged)
+{
+  INDEX i;
+
+  for (i = 0; i < ctSrc; i++) {
+    abThrough[i] = FALSE;
+  }
+
+  if (pbppDst == NULL || ctChanged <= 0) {
+    return;
+  }
+
+  // Lock states aren't updated here because this is called when they change
+  UpdateGraph(bnm);
+
+  const INDEX iDst = PointIndex(pbppDst);
+
+  if (iDst == -1) {
+    return;
+  }
+
+  PrepareRoute();
+
+  // Mark changed points
+  BOOL bOpened = FALSE;
+
+  for (i = 0; i < ctChanged; i++) {
+    const INDEX iPoint = PointIndex(apbppChanged[i]);
+
+    if (iPoint == -1) continue;
+
+    _aubRouteFlags[iPoint] |= RPF_PASSABLE;
+
+    if (!apbppChanged[i]->IsLocked()) {
+      bOpened = TRUE;
+    }
+  }
+
+  // Target itself has changed
+  if (_aubRouteFlags[iDst] & RPF_PASSABLE) {
+    for (i = 0; i < ctSrc; i++) {
+      abThrough[i] = TRUE;
+    }
+    return;
+  }
+
+  // If points have only been locked, the field that has been built before that already
+  // has the paths that were passable, so there's no need to search them again
+  // (lock revision changes once per update, right before the listeners are notified)
+  CFlowField *pffOld = NULL;
+
+  if (!bOpened) {
+    for (INDEX iField = 0; iField < CT_FLOW_FIELDS; iField++) {
+      CFlowField &ff = ffs_affFields[iField];
+
+      if (ff.ff_pbppTarget == pbppDst && ff.ff_ulLockRevision == bnm.bnm_ulLockRevision - 1) {
+        pffOld = &ff;
+        break;
+      }
+    }
+  }
+
+  // Search paths for all sources at once
+  if (pffOld == NULL) {
+    INDEX ctSources = 0;
+
+    for (i = 0; i < ctSrc; i++) {
+      const INDEX iPoint = PointIndex(apbppSrc[i]);
+
+      if (iPoint == -1 || (_aubRouteFlags[iPoint] & RPF_SOURCE)) continue;
+
+      _aubRouteFlags[iPoint] |= RPF_SOURCE;
+      ctSources++;
+    }
+
+    if (ctSources == 0) {
+      return;
+    }
+
+    SearchRoute(iDst, ctSources);
+  }
+
+  const INDEX *aiNext = (pffOld != NULL) ? &pffOld->ff_aiNext[0] : &_aiRouteNext[0];
+  const INDEX ctPoints = ffs_apbppPoints.Count();
+
+  // Follow the path from each source
+  for (i = 0; i < ctSrc; i++) {
+    INDEX iPoint = PointIndex(apbppSrc[i]);
+    INDEX ctSteps = 0;
+
+    while (iPoint != -1 && ctSteps <= ctPoints) {
+      if (_aubRouteFlags[iPoint] & RPF_PASSABLE) {
+        abThrough[i] = TRUE;
+        break;
+      }
+
+      if (iPoint == iDst) break;
+
+      iPoint = aiNext[iPoint];
+      ctSteps++;
+    }
+  }
+};
+
+// Simple generator that doesn't touch the game's random seed
+static ULONG _ulFlowBenchSeed = 0;
+
+static INDEX FlowBenchRandom(INDEX ctRange) {
+  _ulFlowBenchSeed = _ulFlowBenchSeed * 1103515245 + 12345;
+  return INDEX((_ulFlowBenchSeed >> 16) % ULONG(ctRange));
+};
+
+// Run one benchmark case and return amount of mismatching next points
+static INDEX FlowBenchCase(INDEX ctBots, INDEX ctTargets, BOOL bSharedTarget) {
+  CBotNavmesh &bnm = *_pNavmesh;
+  const INDEX ctPoints = bnm.bnm_aPoints.Count();
+  _ulFlowBenchSeed = 0x5EED;
+
+  // Separate fields that don't affect bots
+  CFlowFields ffsBench;
+  ffsBench.Update(bnm, FALSE);
+
+  // Whole fields for every target
+  CFlowFields ffsCheck;
+  ffsCheck.Update(bnm, FALSE);
+
+  CStaticArray<CBotPathPoint *> apbppSrc, apbppDst, apbppSearch, apbppField;
+  apbppSrc.New(ctBots);
+  apbppDst.New(ctBots);
+  apbppSearch.New(ctBots);
+  apbppField.New(ctBots);
+
+  DOUBLE dSearch = 0.0;
+  DOUBLE dField = 0.0;
+  INDEX ctMismatches = 0;
+
+  for (INDEX iTarget = 0; iTarget < ctTargets; iTarget++) {
+    CBotPathPoint *pbppShared = bnm.bnm_aPoints.Pointer(FlowBenchRandom(ctPoints));
+    INDEX iBot;
+
+    for (iBot = 0; iBot < ctBots; iBot++) {
+      apbppDst[iBot] = (bSharedTarget ? pbppShared : bnm.bnm_aPoints.Pointer(FlowBenchRandom(ctPoints)));
+
+      // Bots that are already there don't search for anything
+      do {
+        apbppSrc[iBot] = bnm.bnm_aPoints.Pointer(FlowBenchRandom(ctPoints));
+      } while (apbppSrc[iBot] == apbppDst[iBot]);
+    }
+
+    const INDEX ctRequesters = (bSharedTarget ? ctBots : 1);
+
+    // Every bot searches for its own path (without updating locks of the NavMesh)
+    CTimerValue tvStart = _pTimer->GetHighPrecisionTimer();
+
+    for (iBot = 0; iBot < ctBots; iBot++) {
+      apbppSearch[iBot] = bnm.FindNextPoint(apbppSrc[iBot], apbppDst[iBot], FALSE);
+    }
+
+    dSearch += (_pTimer->GetHighPrecisionTimer() - tvStart).GetSeconds();
+
+    // Bots going to the same target share one field
+    tvStart = _pTimer->GetHighPrecisionTimer();
+
+    for (iBot = 0; iBot < ctBots; iBot++) {
+      apbppField[iBot] = ffsBench.NextPoint(bnm, apbppSrc[iBot], apbppDst[iBot], ctRequesters, FALSE);
+    }
+
+    dField += (_pTimer->GetHighPrecisionTimer() - tvStart).GetSeconds();
+
+    for (iBot = 0; iBot < ctBots; iBot++) {
+      // Searches must agree on whether the target can be reached
+      if ((apbppSearch[iBot] == NULL) != (apbppField[iBot] == NULL)) {
+        ctMismatches++;
+        continue;
+      }
+
+      // Next point must be the same as in a whole field towards this target
+      CBotPathPoint *pbppCheck = ffsCheck.NextPoint(bnm, apbppSrc[iBot], apbppDst[iBot], 2, FALSE);
+
+      if (apbppField[iBot] != pbppCheck) {
+        ctMismatches++;
+      }
+    }
+  }
+
+  CPrintF("  %2d bots, %s: searches %.3f ms, flow fields %.3f ms (%d built), %d mismatches\n",
+    ctBots, (bSharedTarget ? "same target" : "own targets"), dSearch * 1000.0, dField * 1000.0, ffsBench.ffs_ctBuilt, ctMismatches);
+
+  return ctMismatches;
+};
+
+// [Cecil] 2026-10-19: Compare shared flow fields with separate path searches for many bots
+void CECIL_FlowFieldBenchmark(INDEX ctTargets) {
+  if (!_pNavmesh->IsUsable() || _pNavmesh->bnm_aPoints.Count() < 2) {
+    CPrintF("No NavMesh to test flow fields on!\n");
+    return;
+  }
+
+  ctTargets = ClampDn(ctTargets, (INDEX)1);
+
+  const INDEX ctPoints = _pNavmesh->bnm_aPoints.Count();
+  static const INDEX aiBots[3] = { 8, 16, 31 };
+
+  CPrintF("Flow field benchmark on %d points with %d targets:\n", ctPoints, ctTargets);
+
+  INDEX ctMismatches = 0;
+
+  for (INDEX iCase = 0; iCase < 3; iCase++) {
+    ctMismatches += FlowBenchCase(aiBots[iCase], ctTargets, TRUE);
+  }
+
+  // Each bot going somewhere else
+  ctMismatches += FlowBenchCase(aiBots[2], ctTargets, FALSE);
+
+  if (ctMismatches == 0) {
+    CPrintF("^c00ff00PASS^r: all next points match whole flow fields\n");
+  } else {
+    CPrintF("^cff0000FAIL^r: %d mismatching next points\n", ctMismatches);
+  }
+};
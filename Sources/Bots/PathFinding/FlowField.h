@@ -0,0 +1,107 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#ifndef _CECILBOTS_FLOWFIELD_H
+#define _CECILBOTS_FLOWFIELD_H
+
+#include "PathPoint.h"
+
+class CBotNavmesh;
+
+// Amount of flow fields that are kept at the same time
+#define CT_FLOW_FIELDS 4
+
+// [Cecil] 2026-10-19: Point with its index in the flow field graph
+struct SFlowPoint {
+  CBotPathPoint *pbpp;
+  INDEX iPoint;
+};
+
+// [Cecil] 2026-10-19: Next points from all NavMesh points towards one target point
+class DECL_DLL CFlowField {
+  public:
+    CBotPathPoint *ff_pbppTarget;  // point that the field leads to
+    ULONG ff_ulLockRevision;       // lock states that the field has been built with
+    ULONG ff_ulLastUse;            // when the field has been used the last time
+    CStaticArray<INDEX> ff_aiNext; // next point from each point (-1 if the target can't be reached)
+
+  public:
+    // Constructor
+    CFlowField(void);
+
+    // Forget the field
+    void Clear(void);
+};
+
+// [Cecil] 2026-10-19: Flow fields of the NavMesh that are rebuilt on demand
+class DECL_DLL CFlowFields {
+  public:
+    ULONG ffs_ulRevision; // NavMesh revision of the point graph
+    BOOL ffs_bGraph;      // point graph has been built
+
+    // Point graph with reversed connections
+    CStaticArray<CBotPathPoint *> ffs_apbppPoints; // points in the NavMesh order
+    CStaticArray<SFlowPoint> ffs_aSorted; // points sorted by their addresses
+    CStaticArray<INDEX> ffs_aiFirstLink; // first connection to each point (with one extra at the end)
+    CStaticArray<INDEX> ffs_aiLinkFrom;  // points that connect to each point
+    CStaticArray<FLOAT> ffs_afLinkCost;  // distances of these connections
+
+    CFlowField ffs_affFields[CT_FLOW_FIELDS];
+    ULONG ffs_ulUses;   // field usage counter
+    INDEX ffs_ctBuilt;  // how many fields have been built
+
+  public:
+    // Constructor
+    CFlowFields(void);
+
+    // Forget the graph and all fields
+    void Clear(void);
+
+    // Prepare the graph for the current state of the NavMesh (optionally without updating lock states)
+    void Update(CBotNavmesh &bnm, BOOL bUpdateLocks = TRUE);
+
+    // Find next point on the shortest path from one point to another
+    // Fields are only built for targets that more than one bot is going to, otherwise only the path from the source is searched
+    CBotPathPoint *NextPoint(CBotNavmesh &bnm, CBotPathPoint *pbppSrc, CBotPathPoint *pbppDst, INDEX ctRequesters, BOOL bUpdateLocks = TRUE);
+
+    // Check for each source if the shortest path towards some point goes through any of the points that have just changed their lock states
+    // Changed points are considered passable (even if they're locked), so paths that have just been blocked or opened are both found
+    void RoutesThrough(CBotNavmesh &bnm, CBotPathPoint *pbppDst, CBotPathPoint **apbppSrc, BOOL *abThrough, INDEX ctSrc,
+                       CBotPathPoint **apbppChanged, INDEX ctChanged);
+
+  private:
+    // Find index of a point in the graph (-1 if not found)
+    INDEX PointIndex(CBotPathPoint *pbpp) const;
+
+    // Rebuild the point graph if NavMesh points have been changed
+    void UpdateGraph(CBotNavmesh &bnm);
+
+    // Rebuild the point graph from the NavMesh
+    void BuildGraph(CBotNavmesh &bnm);
+
+    // Build a field towards some point
+    void BuildField(CFlowField &ff, CBotPathPoint *pbppTarget, ULONG ulLockRevision);
+
+    // Reset route search data for the current point graph
+    void PrepareRoute(void);
+
+    // Search backwards from the target until all marked sources are reached, like for a field (marked passable points can be locked)
+    void SearchRoute(INDEX iDst, INDEX ctSources);
+};
+
+// [Cecil] 2026-10-19: Compare shared flow fields with separate path searches for many bots
+DECL_DLL void CECIL_FlowFieldBenchmark(INDEX ctTargets);
+
+#endif // _CECILBOTS_FLOWFIELD_H
@@ -16,18 +16,44 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #include "StdH.h"
 #include "Navmesh.h"
 #include "PathPoint.h"
+#include "NavmeshTransfer.h"
+
+#include <windows.h>
 
 // [Cecil] 2021-06-16: Only for ImportantForNavMesh() function
 #include "Bots/Logic/BotFunctions.h"
 
+// [Cecil] 2026-10-19: For important point types
+#include "EntitiesMP/Item.h"
+#include "EntitiesMP/Switch.h"
+#include "EntitiesMP/MovingBrush.h"
+#include "EntitiesMP/Marker.h"
+
 // [Cecil] 2018-10-23: Bot NavMesh
 extern CBotNavmesh *_pNavmesh = NULL;
 
+// [Cecil] 2026-10-19: Last revision of any NavMesh (NavMeshes can be created on the loader thread)
+static volatile LONG _lLastNavmeshRevision = 0;
+
+// [Cecil] 2026-10-19: Get new revision for some NavMesh that has never been used by any NavMesh before
+// A new NavMesh at the address of a deleted one never matches caches of the old one this way
+ULONG NewNavmeshRevision(void) {
+  return (ULONG)InterlockedIncrement(&_lLastNavmeshRevision);
+};
+
 // Constructor & Destructor
 CBotNavmesh::CBotNavmesh(void) {
   bnm_pwoWorld = NULL;
   bnm_bGenerated = FALSE;
   bnm_iNextPointID = 0;
+  bnm_bAwaitingSync = FALSE;
+  bnm_ulRevision = 0;
+  bnm_ulBaseHash = 0;
+  bnm_bBaseOnDisk = FALSE;
+  bnm_bLocksChanged = TRUE;
+  bnm_tmLocksUpdated = -1.0f;
+  bnm_bImportantChanged = TRUE;
+  bnm_ulLockRevision = 0;
 };
 
 CBotNavmesh::~CBotNavmesh(void) {
@@ -53,9 +79,19 @@ void CBotNavmesh::WriteNavmesh(CTStream *strm) {
 };
 
 void CBotNavmesh::ReadNavmesh(CTStream *strm) {
+  ReadPoints_t(strm);
+  LinkEntities(_pNetwork->ga_World);
+};
+
+// [Cecil] 2026-10-19: Read points without linking them to the world (safe outside the game thread)
+void CBotNavmesh::ReadPoints_t(CTStream *strm, SNavmeshProgress *pnp) {
   INDEX iVersion;
   INDEX ctPoints;
 
+  Changed();
+  bnm_bLocksChanged = TRUE;
+  bnm_bImportantChanged = TRUE;
+
   if (strm->PeekID_t() == CChunkID("BNM1")) {
     strm->ExpectID_t("BNM1"); // Bot NavMesh v1
     iVersion = LEGACY_PATHPOINT_VERSION; // last legacy path point version
@@ -69,56 +105,520 @@ void CBotNavmesh::ReadNavmesh(CTStream *strm) {
   *strm >> bnm_iNextPointID; // next point ID
   *strm >> ctPoints; // amount of points
 
+  if (pnp != NULL) {
+    pnp->ctTotal = ctPoints;
+  }
+
   // Create points
   bnm_aPoints.Push(ctPoints);
 
+  bnm_aReadEntities.Clear();
+  bnm_aReadEntities.New(ctPoints);
+
   // Read points
   for (INDEX iPoint = 0; iPoint < ctPoints; iPoint++) {
+    // Reading has been cancelled from another thread
+    if (pnp != NULL && pnp->bCancel) {
+      ThrowF_t("NavMesh reading has been cancelled");
+    }
+
     CBotPathPoint *pbpp = &bnm_aPoints[iPoint];
-    pbpp->ReadPoint(strm, iVersion);
+    pbpp->ReadPoint(strm, iVersion, *this, bnm_aReadEntities[iPoint]);
+
+    if (pnp != NULL) {
+      pnp->ctRead = iPoint + 1;
+    }
   }
 };
 
-// Saving & Loading
-void CBotNavmesh::SaveNavmesh(CWorld &wo) {
+// Entity with its ID for quick search
+struct SEntityByID {
+  ULONG ulID;
+  CEntity *pen;
+};
+
+static int qsort_CompareEntityIDs(const void *pv0, const void *pv1) {
+  const SEntityByID &eid0 = *(const SEntityByID *)pv0;
+  const SEntityByID &eid1 = *(const SEntityByID *)pv1;
+
+  if (eid0.ulID < eid1.ulID) return -1;
+  if (eid0.ulID > eid1.ulID) return +1;
+  return 0;
+};
+
+// Find entity by its ID in a sorted array
+static CEntity *FindSortedEntity(CStaticStackArray<SEntityByID> &aEntities, INDEX iEntityID) {
+  // Invalid ID
+  if (iEntityID < 0) return NULL;
+
+  INDEX iMin = 0;
+  INDEX iMax = aEntities.Count() - 1;
+
+  while (iMin <= iMax) {
+    const INDEX iMid = (iMin + iMax) / 2;
+    const ULONG ulMid = aEntities[iMid].ulID;
+
+    if (ulMid == ULONG(iEntityID)) {
+      return aEntities[iMid].pen;
+    }
+
+    if (ulMid < ULONG(iEntityID)) {
+      iMin = iMid + 1;
+    } else {
+      iMax = iMid - 1;
+    }
+  }
+
+  return NULL;
+};
+
+// [Cecil] 2026-10-19: Link points that have been read to entities in the world
+void CBotNavmesh::LinkEntities(CWorld &wo) {
+  const INDEX ctPoints = Min(bnm_aPoints.Count(), bnm_aReadEntities.Count());
+
+  if (ctPoints <= 0) {
+    bnm_aReadEntities.Clear();
+    return;
+  }
+
+  // Sort existing entities by their IDs once instead of searching through all of them for each point
+  CStaticStackArray<SEntityByID> aEntities;
+
+  FOREACHINDYNAMICCONTAINER(wo.wo_cenEntities, CEntity, iten) {
+    CEntity *pen = iten;
+
+    if (!(pen->GetFlags() & ENF_DELETED)) {
+      SEntityByID &eid = aEntities.Push();
+      eid.ulID = pen->en_ulID;
+      eid.pen = pen;
+    }
+  }
+
+  if (aEntities.Count() > 1) {
+    qsort(&aEntities[0], aEntities.Count(), sizeof(SEntityByID), qsort_CompareEntityIDs);
+  }
+
+  for (INDEX iPoint = 0; iPoint < ctPoints; iPoint++) {
+    CBotPathPoint &bpp = bnm_aPoints[iPoint];
+    const SPointEntities &pe = bnm_aReadEntities[iPoint];
+
+    bpp.bpp_penImportant = FindSortedEntity(aEntities, pe.iImportant);
+    bpp.bpp_penLock = FindSortedEntity(aEntities, pe.iLock);
+  }
+
+  bnm_aReadEntities.Clear();
+  bnm_bLocksChanged = TRUE;
+  bnm_bImportantChanged = TRUE;
+};
+
+// [Cecil] 2026-10-19: Serialized NavMesh in memory
+struct SCachedNavmesh {
+  ULONG ulHash;
+  CStaticArray<UBYTE> aubData;
+  BOOL bOnDisk; // NavMesh data can be found in the NavMesh file
+};
+
+// Amount of recently loaded NavMeshes to keep in memory
+#define NAVMESH_CACHE_SIZE 4
+
+static SCachedNavmesh _aNavmeshCache[NAVMESH_CACHE_SIZE];
+static INDEX _iNextCachedNavmesh = 0;
+
+// Find cached NavMesh by its checksum
+static SCachedNavmesh *FindCachedNavmesh(ULONG ulHash) {
+  for (INDEX i = 0; i < NAVMESH_CACHE_SIZE; i++) {
+    SCachedNavmesh &cn = _aNavmeshCache[i];
+
+    if (cn.aubData.Count() > 0 && cn.ulHash == ulHash) {
+      return &cn;
+    }
+  }
+
+  return NULL;
+};
+
+// Remember serialized NavMesh in the cache
+static void CacheNavmesh(ULONG ulHash, UBYTE *pubData, SLONG slSize, BOOL bOnDisk) {
+  SCachedNavmesh *pcnCached = FindCachedNavmesh(ulHash);
+
+  if (pcnCached != NULL) {
+    // Same data has been saved into the NavMesh file since then
+    if (bOnDisk) pcnCached->bOnDisk = TRUE;
+    return;
+  }
+
+  // Replace the oldest one
+  SCachedNavmesh &cn = _aNavmeshCache[_iNextCachedNavmesh];
+  _iNextCachedNavmesh = (_iNextCachedNavmesh + 1) % NAVMESH_CACHE_SIZE;
+
+  cn.ulHash = ulHash;
+  cn.bOnDisk = bOnDisk;
+  cn.aubData.Clear();
+  cn.aubData.New(slSize);
+  memcpy(&cn.aubData[0], pubData, slSize);
+};
+
+// [Cecil] 2026-10-19: Read the entire file into memory
+void ReadFileData_t(const CTFileName &fnFile, CStaticArray<UBYTE> &aubData) {
+  CTFileStream strm;
+  strm.Open_t(fnFile);
+
+  const SLONG slSize = strm.GetStreamSize();
+
+  aubData.Clear();
+  aubData.New(slSize);
+  strm.Read_t(&aubData[0], slSize);
+
+  strm.Close();
+};
+
+// [Cecil] 2026-10-19: Get NavMesh file for a specific world
+CTFileName NavmeshFileName(CWorld &wo) {
   const CTFileName &fnWorld = wo.wo_fnmFileName;
 
   // Get level path hash and append it to the level filename
   CTFileName fnFile;
   fnFile.PrintF("Cecil\\Navmeshes\\%s_%08X.nav", fnWorld.FileName().str_String, fnWorld.GetHash());
-  
-  CTFileStream strm;
-  strm.Create_t(fnFile);
-            
+
+  return fnFile;
+};
+
+// [Cecil] 2026-10-19: Check if the NavMesh file has a specific checksum
+BOOL NavmeshFileMatches(CWorld &wo, ULONG ulHash) {
+  CStaticArray<UBYTE> aubFile;
+
+  try {
+    ReadFileData_t(NavmeshFileName(wo), aubFile);
+
+  } catch (char *strError) {
+    (void)strError;
+    return FALSE;
+  }
+
+  if (aubFile.Count() <= 0) {
+    return FALSE;
+  }
+
+  return NavmeshDataHash(&aubFile[0], aubFile.Count()) == ulHash;
+};
+
+// Saving & Loading
+void CBotNavmesh::SaveNavmesh(CWorld &wo) {
+  const CTFileName fnFile = NavmeshFileName(wo);
+
   bnm_pwoWorld = &wo;
-  WriteNavmesh(&strm);
+
+  // [Cecil] 2026-10-19: Forget ledges that might not match edited points anymore
+  ResetEditedLedges();
+
+  CTMemoryStream strmNavmesh;
+  WriteNavmesh(&strmNavmesh);
+
+  UBYTE *pubData;
+  SLONG slSize;
+  strmNavmesh.LockBuffer(&pubData, &slSize);
+
+  try {
+    CTFileStream strm;
+    strm.Create_t(fnFile);
+    strm.Write_t(pubData, slSize);
+    strm.Close();
+
+  } catch (char *strError) {
+    strmNavmesh.UnlockBuffer();
+    throw strError;
+  }
+
+  // [Cecil] 2026-10-19: Saved NavMesh is the new base without any edits
+  bnm_ulBaseHash = NavmeshDataHash(pubData, slSize);
+  bnm_bBaseOnDisk = TRUE;
+  CacheNavmesh(bnm_ulBaseHash, pubData, slSize, TRUE);
+
+  strmNavmesh.UnlockBuffer();
+
+  bnm_aiDeletedPoints.PopAll();
+
+  for (INDEX iPoint = 0; iPoint < bnm_aPoints.Count(); iPoint++) {
+    bnm_aPoints[iPoint].bpp_bEdited = FALSE;
+  }
 
   CPrintF("Saved NavMesh for the current map into '%s'\n", fnFile.str_String);
-  strm.Close();
 };
 
 void CBotNavmesh::LoadNavmesh(CWorld &wo) {
-  const CTFileName &fnWorld = wo.wo_fnmFileName;
+  const CTFileName fnFile = NavmeshFileName(wo);
 
-  // Get navmesh file using a level path hash
-  CTFileName fnFile;
-  fnFile.PrintF("Cecil\\Navmeshes\\%s_%08X.nav", fnWorld.FileName().str_String, fnWorld.GetHash());
-  
-  CTFileStream strm;
-  strm.Open_t(fnFile);
+  CStaticArray<UBYTE> aubFile;
+  ReadFileData_t(fnFile, aubFile);
 
-  ClearNavmesh();
+  if (aubFile.Count() <= 0) {
+    ThrowF_t("NavMesh file '%s' is empty!", fnFile.str_String);
+  }
 
   bnm_pwoWorld = &wo;
-  ReadNavmesh(&strm);
+  ReadBase_t(&aubFile[0], aubFile.Count(), TRUE);
 
   CPrintF("Loaded NavMesh for the current map from '%s'\n", fnFile.str_String);
-  strm.Close();
+};
+
+// [Cecil] 2026-10-19: Read serialized NavMesh and remember it as the base for runtime edits
+void CBotNavmesh::ReadBase_t(UBYTE *pubData, SLONG slSize, BOOL bOnDisk) {
+  CWorld *pwo = bnm_pwoWorld;
+  ClearNavmesh();
+  bnm_pwoWorld = pwo;
+
+  CTMemoryStream strm;
+  strm.Write_t(pubData, slSize);
+  strm.SetPos_t(0);
+
+  ReadNavmesh(&strm);
+  SetBase(pubData, slSize, bOnDisk);
+};
+
+// [Cecil] 2026-10-19: Remember serialized NavMesh as the base for runtime edits
+void CBotNavmesh::SetBase(UBYTE *pubData, SLONG slSize, BOOL bOnDisk) {
+  bnm_ulBaseHash = NavmeshDataHash(pubData, slSize);
+  bnm_bBaseOnDisk = bOnDisk;
+  CacheNavmesh(bnm_ulBaseHash, pubData, slSize, bOnDisk);
+};
+
+// [Cecil] 2026-10-19: Restore base NavMesh with a specific checksum from the cache or from the NavMesh file
+BOOL CBotNavmesh::RestoreBase_t(ULONG ulHash, CWorld &wo) {
+  bnm_pwoWorld = &wo;
+
+  // Recently loaded
+  SCachedNavmesh *pcn = FindCachedNavmesh(ulHash);
+
+  if (pcn != NULL) {
+    ReadBase_t(&pcn->aubData[0], pcn->aubData.Count(), pcn->bOnDisk);
+    return TRUE;
+  }
+
+  // Current NavMesh file
+  CStaticArray<UBYTE> aubFile;
+
+  try {
+    ReadFileData_t(NavmeshFileName(wo), aubFile);
+
+  } catch (char *strError) {
+    CPrintF("%s\n", strError);
+    return FALSE;
+  }
+
+  if (aubFile.Count() <= 0 || NavmeshDataHash(&aubFile[0], aubFile.Count()) != ulHash) {
+    return FALSE;
+  }
+
+  ReadBase_t(&aubFile[0], aubFile.Count(), TRUE);
+  return TRUE;
+};
+
+// [Cecil] 2026-10-19: Edited path point
+struct SPointEdit {
+  INDEX iID;
+  FLOAT3D vPos;
+  FLOAT fRange;
+  ULONG ulFlags;
+  INDEX iImportantEntity;
+  INDEX iNext;
+  INDEX iLockEntity;
+  CPlacement3D plLockOrigin;
+  CStaticArray<INDEX> aiConnections;
+};
+
+// NavMesh state for savegames (full NavMesh or base checksum with runtime edits)
+void CBotNavmesh::WriteState(CTStream *strm, BOOL bFull) {
+  strm->WriteID_t("BNMS"); // Bot NavMesh State
+
+  // Write the whole NavMesh if it can't be restored from the NavMesh file
+  if (bFull || bnm_ulBaseHash == 0 || !bnm_bBaseOnDisk) {
+    *strm << UBYTE(TRUE);
+    WriteNavmesh(strm);
+    return;
+  }
+
+  *strm << UBYTE(FALSE);
+  *strm << bnm_ulBaseHash;
+  *strm << bnm_bGenerated;
+  *strm << bnm_iNextPointID;
+
+  // Write deleted points
+  const INDEX ctDeleted = bnm_aiDeletedPoints.Count();
+  *strm << ctDeleted;
+
+  for (INDEX iDeleted = 0; iDeleted < ctDeleted; iDeleted++) {
+    *strm << bnm_aiDeletedPoints[iDeleted];
+  }
+
+  // Write edited points
+  INDEX ctEdited = 0;
+  INDEX iPoint;
+
+  for (iPoint = 0; iPoint < bnm_aPoints.Count(); iPoint++) {
+    if (bnm_aPoints[iPoint].bpp_bEdited) {
+      ctEdited++;
+    }
+  }
+
+  *strm << ctEdited;
+
+  for (iPoint = 0; iPoint < bnm_aPoints.Count(); iPoint++) {
+    CBotPathPoint &bpp = bnm_aPoints[iPoint];
+
+    if (!bpp.bpp_bEdited) continue;
+
+    *strm << bpp.bpp_iIndex;
+    *strm << bpp.bpp_vPos;
+    *strm << bpp.bpp_fRange;
+    *strm << bpp.bpp_ulFlags;
+
+    *strm << INDEX(ASSERT_ENTITY(bpp.bpp_penImportant) ? bpp.bpp_penImportant->en_ulID : -1);
+    *strm << INDEX(bpp.bpp_pbppNext != NULL ? bpp.bpp_pbppNext->bpp_iIndex : -1);
+
+    if (ASSERT_ENTITY(bpp.bpp_penLock)) {
+      *strm << INDEX(bpp.bpp_penLock->en_ulID);
+      *strm << bpp.bpp_plLockOrigin;
+    } else {
+      *strm << INDEX(-1);
+    }
+
+    // Connections by point IDs
+    *strm << bpp.bpp_cbppPoints.Count();
+
+    FOREACHINDYNAMICCONTAINER(bpp.bpp_cbppPoints, CBotPathPoint, itbpp) {
+      *strm << itbpp->bpp_iIndex;
+    }
+  }
+};
+
+void CBotNavmesh::ReadState(CTStream *strm) {
+  Changed();
+
+  // Old savegames with the whole NavMesh
+  if (strm->PeekID_t() != CChunkID("BNMS")) {
+    ClearNavmesh();
+    ReadNavmesh(strm);
+    return;
+  }
+
+  strm->ExpectID_t("BNMS"); // Bot NavMesh State
+
+  UBYTE bFull;
+  *strm >> bFull;
+
+  if (bFull) {
+    ClearNavmesh();
+    ReadNavmesh(strm);
+    return;
+  }
+
+  ULONG ulHash;
+  BOOL bGenerated;
+  INDEX iNextPointID;
+  *strm >> ulHash >> bGenerated >> iNextPointID;
+
+  // Read deleted points
+  INDEX ctDeleted;
+  *strm >> ctDeleted;
+
+  CStaticArray<INDEX> aiDeleted;
+  aiDeleted.New(ctDeleted);
+
+  INDEX i;
+
+  for (i = 0; i < ctDeleted; i++) {
+    *strm >> aiDeleted[i];
+  }
+
+  // Read edited points
+  INDEX ctEdited;
+  *strm >> ctEdited;
+
+  CStaticArray<SPointEdit> aEdits;
+  aEdits.New(ctEdited);
+
+  for (i = 0; i < ctEdited; i++) {
+    SPointEdit &pe = aEdits[i];
+
+    *strm >> pe.iID >> pe.vPos >> pe.fRange >> pe.ulFlags;
+    *strm >> pe.iImportantEntity >> pe.iNext >> pe.iLockEntity;
+
+    if (pe.iLockEntity != -1) {
+      *strm >> pe.plLockOrigin;
+    } else {
+      pe.plLockOrigin = CPlacement3D(FLOAT3D(0.0f, 0.0f, 0.0f), ANGLE3D(0.0f, 0.0f, 0.0f));
+    }
+
+    INDEX ctConnections;
+    *strm >> ctConnections;
+    pe.aiConnections.New(ctConnections);
+
+    for (INDEX iConnection = 0; iConnection < ctConnections; iConnection++) {
+      *strm >> pe.aiConnections[iConnection];
+    }
+  }
+
+  // Restore the base NavMesh
+  CWorld &wo = *(bnm_pwoWorld != NULL ? bnm_pwoWorld : &_pNetwork->ga_World);
+
+  if (!RestoreBase_t(ulHash, wo)) {
+    CPrintF("Cannot restore NavMesh %08X for the current map!\n", ulHash);
+    ClearNavmesh();
+    return;
+  }
+
+  bnm_bGenerated = bGenerated;
+
+  // Reapply runtime edits
+  for (i = 0; i < ctDeleted; i++) {
+    CBotPathPoint *pbpp = FindPointByID(aiDeleted[i]);
+
+    if (pbpp != NULL) {
+      DeletePoint(pbpp);
+    }
+  }
+
+  // Create new points first for connections
+  for (i = 0; i < ctEdited; i++) {
+    if (FindPointByID(aEdits[i].iID) == NULL) {
+      CBotPathPoint *pbpp = AddPoint(aEdits[i].vPos, NULL);
+      pbpp->bpp_iIndex = aEdits[i].iID;
+    }
+  }
+
+  for (i = 0; i < ctEdited; i++) {
+    SPointEdit &pe = aEdits[i];
+    CBotPathPoint *pbpp = FindPointByID(pe.iID);
+
+    pbpp->bpp_vPos = pe.vPos;
+    pbpp->bpp_fRange = pe.fRange;
+    pbpp->bpp_ulFlags = pe.ulFlags;
+    pbpp->bpp_penImportant = FindEntityByID(&wo, pe.iImportantEntity);
+    pbpp->bpp_pbppNext = FindPointByID(pe.iNext);
+    pbpp->bpp_penLock = FindEntityByID(&wo, pe.iLockEntity);
+    pbpp->bpp_plLockOrigin = pe.plLockOrigin;
+    pbpp->bpp_bEdited = TRUE;
+
+    pbpp->bpp_cbppPoints.Clear();
+
+    for (INDEX iConnection = 0; iConnection < pe.aiConnections.Count(); iConnection++) {
+      CBotPathPoint *pbppTarget = FindPointByID(pe.aiConnections[iConnection]);
+
+      if (pbppTarget != NULL) {
+        pbpp->bpp_cbppPoints.Add(pbppTarget);
+      }
+    }
+  }
+
+  bnm_iNextPointID = iNextPointID;
+  bnm_bLocksChanged = TRUE;
+  bnm_bImportantChanged = TRUE;
 };
 
 void CBotNavmesh::ClearNavmesh(void) {
   // [Cecil] 2021-06-22: Untarget all bots
-  for (INDEX iBot = 0; iBot < _aPlayerBots.Count(); iBot++) {
+  // [Cecil] 2026-10-19: Only from the NavMesh that they're using
+  for (INDEX iBot = 0; this == _pNavmesh && iBot < _aPlayerBots.Count(); iBot++) {
     CPlayerBot *penBot = (CPlayerBot *)_aPlayerBots[iBot].pen;
 
     penBot->GetProps().m_pbppCurrent = NULL;
@@ -134,10 +634,42 @@ void CBotNavmesh::ClearNavmesh(void) {
   // Ready for the next generation
   bnm_bGenerated = FALSE;
   bnm_iNextPointID = 0;
+
+  // [Cecil] 2026-10-19: Nothing has been loaded
+  bnm_ulBaseHash = 0;
+  bnm_bBaseOnDisk = FALSE;
+  bnm_aiDeletedPoints.PopAll();
+
+  bnm_cbppLocks.Clear();
+  bnm_bLocksChanged = TRUE;
+  bnm_bImportantChanged = TRUE;
+  bnm_ffsFlow.Clear();
+  bnm_aReadEntities.Clear();
+  Changed();
+};
+
+// [Cecil] 2026-10-19: Replace the global NavMesh with another one
+void ReplaceNavmesh(CBotNavmesh *pbnmNew) {
+  CBotNavmesh *pbnmOld = _pNavmesh;
+
+  // Keep the same listeners and the world
+  for (INDEX iListener = 0; iListener < pbnmOld->bnm_aLockListeners.Count(); iListener++) {
+    pbnmNew->bnm_aLockListeners.Push() = pbnmOld->bnm_aLockListeners[iListener];
+  }
+
+  if (pbnmNew->bnm_pwoWorld == NULL) {
+    pbnmNew->bnm_pwoWorld = pbnmOld->bnm_pwoWorld;
+  }
+
+  // Untarget all bots from the old NavMesh before switching
+  delete pbnmOld;
+  _pNavmesh = pbnmNew;
 };
 
 // Add a new path point to the navmesh
 CBotPathPoint *CBotNavmesh::AddPoint(const FLOAT3D &vPoint, CPathPolygon *bppo) {
+  Changed();
+
   CBotPathPoint &bppNew = bnm_aPoints.Push();
   bppNew.bpp_iIndex = bnm_iNextPointID++;
   bppNew.bpp_vPos = vPoint;
@@ -146,6 +678,127 @@ CBotPathPoint *CBotNavmesh::AddPoint(const FLOAT3D &vPoint, CPathPolygon *bppo)
   return &bppNew;
 };
 
+// [Cecil] 2026-10-19: Remove path point from the navmesh
+void CBotNavmesh::DeletePoint(CBotPathPoint *pbpp) {
+  Changed();
+
+  for (INDEX iPoint = 0; iPoint < bnm_aPoints.Count(); iPoint++) {
+    CBotPathPoint *pbppCheck = bnm_aPoints.Pointer(iPoint);
+
+    // Remove connection with this point
+    if (pbppCheck->bpp_cbppPoints.IsMember(pbpp)) {
+      pbppCheck->bpp_cbppPoints.Remove(pbpp);
+    }
+
+    // Reset next important point
+    if (pbppCheck->bpp_pbppNext == pbpp) {
+      pbppCheck->bpp_pbppNext = NULL;
+      pbppCheck->bpp_bEdited = TRUE;
+    }
+  }
+
+  // Untarget this point
+  for (INDEX iBot = 0; iBot < _aPlayerBots.Count(); iBot++) {
+    SBotProperties &props = ((CPlayerBot *)_aPlayerBots[iBot].pen)->GetProps();
+
+    if (props.m_pbppCurrent == pbpp) props.m_pbppCurrent = NULL;
+    if (props.m_pbppTarget == pbpp) props.m_pbppTarget = NULL;
+  }
+
+  if (bnm_cbppLocks.IsMember(pbpp)) {
+    bnm_cbppLocks.Remove(pbpp);
+  }
+
+  if (pbpp->IsImportant()) {
+    bnm_bImportantChanged = TRUE;
+  }
+
+  bnm_aiDeletedPoints.Push() = pbpp->bpp_iIndex;
+  bnm_aPoints.Delete(pbpp);
+};
+
+// [Cecil] 2026-10-19: Update lock states of all points once per tick
+void CBotNavmesh::UpdateLocks(void) {
+  const TIME tmNow = _pTimer->CurrentTick();
+
+  if (!bnm_bLocksChanged && bnm_tmLocksUpdated == tmNow) {
+    return;
+  }
+
+  bnm_tmLocksUpdated = tmNow;
+
+  // Gather points with lock entities
+  if (bnm_bLocksChanged) {
+    bnm_bLocksChanged = FALSE;
+    bnm_cbppLocks.Clear();
+
+    for (INDEX iPoint = 0; iPoint < bnm_aPoints.Count(); iPoint++) {
+      CBotPathPoint *pbpp = bnm_aPoints.Pointer(iPoint);
+
+      if (pbpp->bpp_penLock != NULL) {
+        bnm_cbppLocks.Add(pbpp);
+
+      } else if (pbpp->bpp_bLocked) {
+        pbpp->bpp_bLocked = FALSE;
+
+        NotifyLockChanged(pbpp);
+      }
+    }
+  }
+
+  // Sample each lock entity
+  FOREACHINDYNAMICCONTAINER(bnm_cbppLocks, CBotPathPoint, itbpp) {
+    CBotPathPoint *pbpp = itbpp;
+    const BOOL bLocked = pbpp->LockMoved();
+
+    if (bLocked == pbpp->bpp_bLocked) continue;
+
+    pbpp->bpp_bLocked = bLocked;
+
+    NotifyLockChanged(pbpp);
+  }
+
+  // Notify listeners about all changes at once, when every point has its new lock state
+  const INDEX ctChanged = bnm_apbppLockChanged.Count();
+
+  if (ctChanged == 0) {
+    return;
+  }
+
+  bnm_ulLockRevision++;
+
+  for (INDEX iListener = 0; iListener < bnm_aLockListeners.Count(); iListener++) {
+    bnm_aLockListeners[iListener].pFunc(&bnm_apbppLockChanged[0], ctChanged, bnm_aLockListeners[iListener].pData);
+  }
+
+  bnm_apbppLockChanged.PopAll();
+};
+
+// [Cecil] 2026-10-19: Remember the changed lock state to notify listeners after the update
+void CBotNavmesh::NotifyLockChanged(CBotPathPoint *pbpp) {
+  bnm_apbppLockChanged.Push() = pbpp;
+};
+
+// [Cecil] 2026-10-19: Subscribe to lock state changes
+void CBotNavmesh::AddLockListener(CLockChangedFunc pFunc, void *pData) {
+  SLockListener &ll = bnm_aLockListeners.Push();
+  ll.pFunc = pFunc;
+  ll.pData = pData;
+};
+
+void CBotNavmesh::RemoveLockListener(CLockChangedFunc pFunc, void *pData) {
+  for (INDEX i = 0; i < bnm_aLockListeners.Count(); i++) {
+    SLockListener &ll = bnm_aLockListeners[i];
+
+    if (ll.pFunc != pFunc || ll.pData != pData) continue;
+
+    // Replace with the last one
+    ll = bnm_aLockListeners[bnm_aLockListeners.Count() - 1];
+    bnm_aLockListeners.Pop();
+    return;
+  }
+};
+
 // Find a point by its ID
 CBotPathPoint *CBotNavmesh::FindPointByID(INDEX iPoint) {
   // ID can't be negative
@@ -164,6 +817,156 @@ CBotPathPoint *CBotNavmesh::FindPointByID(INDEX iPoint) {
   return NULL;
 };
 
+// [Cecil] 2026-10-19: Determine type of an important point
+static INDEX ImportantPointType(CBotPathPoint *pbpp, CEntity *&penSource) {
+  CEntity *pen = pbpp->bpp_penImportant;
+  penSource = pen;
+
+  if (pen == NULL) {
+    return IPT_POINT;
+  }
+
+  if (IsDerivedFromDllClass(pen, CItem_DLLClass)) {
+    return IPT_ITEM;
+
+  } else if (IsOfDllClass(pen, CSwitch_DLLClass)) {
+    return IPT_SWITCH;
+
+  } else if (IsOfDllClass(pen, CMovingBrush_DLLClass)) {
+    // Depends on its switch
+    penSource = ((CMovingBrush *)pen)->m_penSwitch;
+    return IPT_MOVINGBRUSH;
+
+  } else if (IsDerivedFromDllClass(pen, CMarker_DLLClass)) {
+    return IPT_MARKER;
+  }
+
+  return IPT_OTHER;
+};
+
+// [Cecil] 2026-10-19: Check if an important point can be used by any bot
+static BOOL ImportantPointUsable(const SImportantPoint &ip) {
+  switch (ip.iType) {
+    case IPT_POINT: case IPT_MARKER:
+      return TRUE;
+
+    case IPT_ITEM: {
+      if (!ASSERT_ENTITY(ip.penSource)) return FALSE;
+
+      const CEntity::RenderType rt = ip.penSource->en_RenderType;
+      return (rt == CEntity::RT_MODEL || rt == CEntity::RT_SKAMODEL);
+    }
+
+    case IPT_SWITCH: case IPT_MOVINGBRUSH: {
+      if (!ASSERT_ENTITY(ip.penSource) || !IsOfDllClass(ip.penSource, CSwitch_DLLClass)) return FALSE;
+
+      return ((CSwitch &)*ip.penSource).m_bUseable;
+    }
+  }
+
+  return FALSE;
+};
+
+// [Cecil] 2026-10-19: Add or remove important point from the list of usable points
+static void SetImportantUsable(CBotNavmesh &bnm, INDEX iImportant, BOOL bUsable) {
+  SImportantPoint &ip = bnm.bnm_aImportant[iImportant];
+
+  if (ip.bUsable == bUsable) {
+    return;
+  }
+
+  ip.bUsable = bUsable;
+  CStaticStackArray<INDEX> &aiUsable = bnm.bnm_aiUsable[ip.iType];
+
+  // Keep points sorted by their order in the NavMesh, so the list is the same regardless of the order of changes
+  const INDEX ctUsable = aiUsable.Count();
+  INDEX iPos = 0;
+  INDEX iMax = ctUsable;
+
+  while (iPos < iMax) {
+    const INDEX iMid = (iPos + iMax) / 2;
+
+    if (aiUsable[iMid] < iImportant) {
+      iPos = iMid + 1;
+    } else {
+      iMax = iMid;
+    }
+  }
+
+  INDEX i;
+
+  if (bUsable) {
+    aiUsable.Push();
+
+    for (i = ctUsable; i > iPos; i--) {
+      aiUsable[i] = aiUsable[i - 1];
+    }
+
+    aiUsable[iPos] = iImportant;
+    return;
+  }
+
+  ASSERT(iPos < ctUsable && aiUsable[iPos] == iImportant);
+
+  for (i = iPos; i < ctUsable - 1; i++) {
+    aiUsable[i] = aiUsable[i + 1];
+  }
+
+  aiUsable.Pop();
+};
+
+// [Cecil] 2026-10-19: Register all important points
+void CBotNavmesh::UpdateImportant(void) {
+  if (!bnm_bImportantChanged) {
+    return;
+  }
+
+  bnm_bImportantChanged = FALSE;
+  bnm_aImportant.PopAll();
+
+  INDEX iType;
+
+  for (iType = 0; iType < IPT_LAST; iType++) {
+    bnm_aiUsable[iType].PopAll();
+  }
+
+  for (INDEX iPoint = 0; iPoint < bnm_aPoints.Count(); iPoint++) {
+    CBotPathPoint *pbpp = bnm_aPoints.Pointer(iPoint);
+
+    if (!pbpp->IsImportant()) continue;
+
+    SImportantPoint &ip = bnm_aImportant.Push();
+    ip.pbpp = pbpp;
+    ip.iType = ImportantPointType(pbpp, ip.penSource);
+    ip.bUsable = FALSE;
+
+    SetImportantUsable(*this, bnm_aImportant.Count() - 1, ImportantPointUsable(ip));
+  }
+};
+
+// [Cecil] 2026-10-19: Update usability of important points that depend on some entity
+void CBotNavmesh::UpdateImportantEntity(CEntity *pen) {
+  // Everything will be reevaluated anyway
+  if (bnm_bImportantChanged) {
+    return;
+  }
+
+  for (INDEX iImportant = 0; iImportant < bnm_aImportant.Count(); iImportant++) {
+    SImportantPoint &ip = bnm_aImportant[iImportant];
+
+    if (ip.penSource == pen) {
+      SetImportantUsable(*this, iImportant, ImportantPointUsable(ip));
+    }
+  }
+};
+
+// [Cecil] 2026-10-19: Notify bots about some important entity becoming (un)usable
+void CECIL_ImportantEntityChanged(CEntity *pen) {
+  if (_pNavmesh != NULL) {
+    _pNavmesh->UpdateImportantEntity(pen);
+  }
+};
+
 // Find some important point
 CBotPathPoint *CBotNavmesh::FindImportantPoint(CPlayerBotController &pb, INDEX iPoint) {
   if (bnm_pwoWorld == NULL) {
@@ -173,48 +976,56 @@ CBotPathPoint *CBotNavmesh::FindImportantPoint(CPlayerBotController &pb, INDEX i
     return NULL;
   }
 
-  // Create array of points
-  CDynamicContainer<CBotPathPoint> cbpp;
-  INDEX iImportantPoint = 0;
+  UpdateImportant();
 
-  for (INDEX i = 0; i < bnm_aPoints.Count(); i++) {
-    CBotPathPoint *pbpp = bnm_aPoints.Pointer(i);
-
-    // Not important
-    if (!pbpp->IsImportant()) continue;
+  // Count usable points
+  INDEX ctUsable = 0;
+  INDEX iType;
 
-    // Entity is not important at the moment
-    CEntity *penEntity = pbpp->bpp_penImportant;
-
-    if (penEntity != NULL && !pb.ImportantForNavMesh(penEntity)) {
-      continue;
-    }
+  for (iType = 0; iType < IPT_LAST; iType++) {
+    ctUsable += bnm_aiUsable[iType].Count();
+  }
 
-    cbpp.Add(pbpp);
-    iImportantPoint++;
+  // Don't use up random numbers if there's nothing to pick
+  if (ctUsable <= 0) {
+    return NULL;
   }
 
-  if (iImportantPoint > 0) {
-    CBotPathPoint *pbppReturn = NULL;
+  // [Cecil] 2026-10-19: Usable points are sorted by their order in the NavMesh,
+  // so the same random index picks the same point on every machine
+  INDEX iIndex;
+
+  // Pick specific point
+  if (iPoint >= 0) {
+    iIndex = Clamp(iPoint, (INDEX)0, INDEX(ctUsable - 1));
 
+  } else {
     // This is safe; CEntity::IRnd() should be static but it's not
     CEntity *penRND = NULL;
-    INDEX iIndex = penRND->IRnd() % iImportantPoint;
+    iIndex = penRND->IRnd() % ctUsable;
+  }
+
+  // Items that have already been picked by this bot in cooperative
+  const ULONG ulBotMask = (1 << CECIL_PlayerIndex(pb.GetPlayerBot()));
 
-    // Pick specific point
-    if (iPoint >= 0) {
-      iIndex = Clamp(iPoint, (INDEX)0, INDEX(iImportantPoint - 1));
-      pbppReturn = cbpp.Pointer(iIndex);
-      cbpp.Clear();
+  for (INDEX iTry = 0; iTry < ctUsable; iTry++) {
+    // Find point under this index in the groups
+    INDEX iInGroup = (iIndex + iTry) % ctUsable;
 
-      return pbppReturn;
+    for (iType = 0; iType < IPT_LAST; iType++) {
+      const INDEX ctGroup = bnm_aiUsable[iType].Count();
+
+      if (iInGroup < ctGroup) break;
+      iInGroup -= ctGroup;
     }
 
-    // Pick random point
-    pbppReturn = cbpp.Pointer(iIndex);
-    cbpp.Clear();
+    const SImportantPoint &ip = bnm_aImportant[bnm_aiUsable[iType][iInGroup]];
+
+    if (ip.iType == IPT_ITEM && (((CItem *)ip.penSource)->m_ulPickedMask & ulBotMask)) {
+      continue;
+    }
 
-    return pbppReturn;
+    return ip.pbpp;
   }
 
   return NULL;
@@ -386,6 +1197,8 @@ void CBotNavmesh::ConnectPoints(INDEX iPoint) {
     return;
   }
 
+  Changed();
+
   CBotPathPoint *bppCurrent = bnm_aPoints.Pointer(iPoint);
 
   // no polygon
@@ -518,6 +1331,8 @@ void CBotNavmesh::ConnectPoints(INDEX iPoint) {
 
 // Remove orphan points
 void CBotNavmesh::CleanupPoints(void) {
+  Changed();
+
   CDynamicContainer<CBotPathPoint> cToRemove;
   CDynamicContainer<CBotPathPoint> cToKeep;
 
@@ -557,6 +1372,117 @@ void CBotNavmesh::CleanupPoints(void) {
   }
 };
 
+// [Cecil] 2026-10-19: Ground checks along connections
+#define LEDGE_STEP    1.0f // distance between ground checks along a connection
+#define LEDGE_HEIGHT  1.0f // height above a connection to check the ground from
+#define LEDGE_DEPTH  16.0f // how deep the ground may be (same as for live pit checks)
+
+// Check ground below some position
+static ULONG CheckLedgeGround(CWorld *pwo, const FLOAT3D &vPos) {
+  const FLOAT3D vFrom = vPos + FLOAT3D(0.0f, LEDGE_HEIGHT, 0.0f);
+  const FLOAT3D vTo = vPos - FLOAT3D(0.0f, LEDGE_DEPTH, 0.0f);
+
+  CCastRay crGround(NULL, vFrom, vTo);
+  crGround.cr_ttHitModels = CCastRay::TT_NONE;
+  crGround.cr_bHitTranslucentPortals = TRUE;
+  crGround.cr_bPhysical = TRUE;
+  CastRayFlags(crGround, pwo, BPOF_PASSABLE);
+
+  // Nothing to stand on
+  if (crGround.cr_pbpoBrushPolygon == NULL) {
+    return PLF_PIT;
+  }
+
+  // Ground may not stay there
+  CEntity *penGround = crGround.cr_penHit;
+
+  if (penGround != NULL && penGround->GetPhysicsFlags() & EPF_MOVABLE) {
+    return PLF_MOVING;
+  }
+
+  return 0;
+};
+
+// Check ground to the side of some position unless there's a wall
+static ULONG CheckLedgeSide(CWorld *pwo, const FLOAT3D &vPos, const FLOAT3D &vSide) {
+  const FLOAT3D vFrom = vPos + FLOAT3D(0.0f, LEDGE_HEIGHT, 0.0f);
+
+  CCastRay crSide(NULL, vFrom, vFrom + vSide);
+  crSide.cr_ttHitModels = CCastRay::TT_NONE;
+  crSide.cr_bHitTranslucentPortals = TRUE;
+  crSide.cr_bPhysical = TRUE;
+  CastRayFlags(crSide, pwo, BPOF_PASSABLE);
+
+  // Can't walk through the wall anyway
+  if (crSide.cr_pbpoBrushPolygon != NULL) {
+    return 0;
+  }
+
+  return CheckLedgeGround(pwo, vPos + vSide);
+};
+
+// [Cecil] 2026-10-19: Check ground along all connections of a point
+void CBotNavmesh::CheckLedges(INDEX iPoint) {
+  if (iPoint < 0 || iPoint >= bnm_aPoints.Count()) {
+    return;
+  }
+
+  Changed();
+
+  CBotPathPoint *pbpp = bnm_aPoints.Pointer(iPoint);
+  CWorld *pwo = (bnm_pwoWorld != NULL ? bnm_pwoWorld : &_pNetwork->ga_World);
+
+  pbpp->bpp_aLedges.PopAll();
+
+  FOREACHINDYNAMICCONTAINER(pbpp->bpp_cbppPoints, CBotPathPoint, itbpp) {
+    CBotPathPoint *pbppTarget = itbpp;
+    const FLOAT3D vDiff = pbppTarget->bpp_vPos - pbpp->bpp_vPos;
+
+    // Horizontal offset to the side of the connection
+    FLOAT3D vSide(-vDiff(3), 0.0f, vDiff(1));
+    const FLOAT fSide = vSide.Length();
+    const BOOL bSides = (fSide > 0.01f);
+
+    if (bSides) {
+      vSide *= NAVMESH_LEDGE_WIDTH / fSide;
+    }
+
+    const INDEX ctSteps = INDEX(vDiff.Length() / LEDGE_STEP) + 1;
+    ULONG ulLedge = PLF_CHECKED;
+
+    for (INDEX iStep = 0; iStep <= ctSteps; iStep++) {
+      const FLOAT3D vPos = pbpp->bpp_vPos + vDiff * (FLOAT(iStep) / FLOAT(ctSteps));
+
+      ulLedge |= CheckLedgeGround(pwo, vPos);
+
+      if (bSides) {
+        ulLedge |= CheckLedgeSide(pwo, vPos, vSide);
+        ulLedge |= CheckLedgeSide(pwo, vPos, -vSide);
+      }
+    }
+
+    pbpp->SetLedge(pbppTarget, ulLedge);
+  }
+};
+
+// [Cecil] 2026-10-19: Forget ledges of connections with edited points
+void CBotNavmesh::ResetEditedLedges(void) {
+  for (INDEX iPoint = 0; iPoint < bnm_aPoints.Count(); iPoint++) {
+    CBotPathPoint &bpp = bnm_aPoints[iPoint];
+
+    if (bpp.bpp_bEdited) {
+      bpp.bpp_aLedges.PopAll();
+      continue;
+    }
+
+    FOREACHINDYNAMICCONTAINER(bpp.bpp_cbppPoints, CBotPathPoint, itbpp) {
+      if (itbpp->bpp_bEdited) {
+        bpp.SetLedge(itbpp, 0);
+      }
+    }
+  }
+};
+
 // [Cecil] Local path points list
 static CDynamicContainer<CPathPoint> _cppPoints;
 // [Cecil] Open and closed lists of nodes
@@ -587,12 +1513,17 @@ CBotPathPoint *CBotNavmesh::ReconstructPath(CPathPoint *ppCurrent) {
   return (ctPoints > 1) ? _cbppPath.Pointer(ctPoints - 2) : NULL;
 };
 
-CBotPathPoint *CBotNavmesh::FindNextPoint(CBotPathPoint *pbppSrc, CBotPathPoint *pbppDst) {
+CBotPathPoint *CBotNavmesh::FindNextPoint(CBotPathPoint *pbppSrc, CBotPathPoint *pbppDst, BOOL bUpdateLocks) {
   // no points at all
   if (pbppSrc == NULL || pbppDst == NULL) {
     return NULL;
   }
 
+  // [Cecil] 2026-10-19: Lock states for this tick
+  if (bUpdateLocks) {
+    UpdateLocks();
+  }
+
   // reset lists
   _cppPoints.Clear();
   _cppOpen.Clear();
@@ -656,6 +1587,7 @@ CBotPathPoint *CBotNavmesh::FindNextPoint(CBotPathPoint *pbppSrc, CBotPathPoint
     // move this point
     _cppOpen.Remove(ppShortest);
     _cppClosed.Add(ppShortest);
+    _pfBotModProfile.IncrementCounter(CBotModProfile::PCI_ASTAR_EXPANSIONS); // [Cecil] 2026-10-19
 
     CBotPathPoint *pbppShortest = ppShortest->pp_bppPoint;
 
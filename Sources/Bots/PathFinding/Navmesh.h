@@ -17,6 +17,7 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #define _CECILBOTS_NAVMESH_H
 
 #include "PathPoint.h"
+#include "FlowField.h"
 
 // [Cecil] 2021-06-17: NavMesh generation types
 #define NAVMESH_TRIANGLES 0 // on each triangle of a polygon
@@ -27,11 +28,47 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #define NAVMESH_GEN_TYPE NAVMESH_EDGES
 
 // [Cecil] 2022-04-17: Current NavMesh version
-#define CURRENT_NAVMESH_VERSION 6
+#define CURRENT_NAVMESH_VERSION 7
 
 // [Cecil] 2021-09-09: Legacy path point version
 #define LEGACY_PATHPOINT_VERSION 4
 
+// [Cecil] 2026-10-19: Distance from connections at which the ground is checked for ledges
+#define NAVMESH_LEDGE_WIDTH 1.0f
+
+// [Cecil] 2026-10-19: Types of important points
+enum EImportantPointType {
+  IPT_POINT = 0,   // Point without an entity
+  IPT_ITEM,        // Item that can be picked
+  IPT_SWITCH,      // Switch that can be used
+  IPT_MOVINGBRUSH, // Moving brush with a switch
+  IPT_MARKER,      // Marker that leads somewhere
+  IPT_OTHER,       // Anything else (never usable)
+
+  IPT_LAST,
+};
+
+// [Cecil] 2026-10-19: Registered important point
+struct SImportantPoint {
+  CBotPathPoint *pbpp; // important point
+  CEntity *penSource;  // entity that determines point's usability
+  INDEX iType;         // point type
+  BOOL bUsable;        // cached usability
+};
+
+// [Cecil] 2026-10-19: Progress of reading NavMesh points
+struct SNavmeshProgress {
+  volatile INDEX ctRead;  // points that have been read so far
+  volatile INDEX ctTotal; // amount of points in the NavMesh
+  volatile BOOL bCancel;  // stop reading as soon as possible
+};
+
+// [Cecil] 2026-10-19: Function that gets notified about all points that have been locked or unlocked during one lock state update
+typedef void (*CLockChangedFunc)(CBotPathPoint **apbppChanged, INDEX ctChanged, void *pData);
+
+// [Cecil] 2026-10-19: Get new revision for some NavMesh that has never been used by any NavMesh before
+DECL_DLL ULONG NewNavmeshRevision(void);
+
 // [Cecil] 2018-10-23: Bot Navigation Mesh
 class DECL_DLL CBotNavmesh {
   public:
@@ -44,11 +81,64 @@ class DECL_DLL CBotNavmesh {
 
     BOOL bnm_bGenerated; // has NavMesh been generated or not
     INDEX bnm_iNextPointID; // index for the next point
+    BOOL bnm_bAwaitingSync; // waiting for the new NavMesh from the server
+    ULONG bnm_ulRevision; // [Cecil] 2026-10-19: changes every time points are edited (unique between all NavMeshes)
+
+    ULONG bnm_ulBaseHash; // checksum of the NavMesh that has been loaded (0 if none)
+    BOOL bnm_bBaseOnDisk; // loaded NavMesh can be found in the NavMesh file
+    CStaticStackArray<INDEX> bnm_aiDeletedPoints; // IDs of points deleted since loading
+
+    // [Cecil] 2026-10-19: Lock state tracking
+    CDynamicContainer<CBotPathPoint> bnm_cbppLocks; // points with lock entities
+    BOOL bnm_bLocksChanged; // lock entities have been changed
+    TIME bnm_tmLocksUpdated; // last tick of the lock state update
+
+    // [Cecil] 2026-10-19: Important point registry
+    CStaticStackArray<SImportantPoint> bnm_aImportant; // all important points
+    CStaticStackArray<INDEX> bnm_aiUsable[IPT_LAST]; // usable important points of each type (in the NavMesh order)
+    BOOL bnm_bImportantChanged; // important points have been changed
+
+    // Lock change listeners
+    struct SLockListener {
+      CLockChangedFunc pFunc;
+      void *pData;
+    };
+    CStaticStackArray<SLockListener> bnm_aLockListeners;
+    CStaticStackArray<CBotPathPoint *> bnm_apbppLockChanged; // points that have changed during the current lock state update
+
+    // [Cecil] 2026-10-19: Changes every time some points get locked or unlocked
+    ULONG bnm_ulLockRevision;
+
+    // [Cecil] 2026-10-19: Paths towards common targets shared between bots
+    CFlowFields bnm_ffsFlow;
+
+    // [Cecil] 2026-10-19: Entities of points that have been read but not linked to the world yet
+    CStaticArray<SPointEntities> bnm_aReadEntities;
+
+    // [Cecil] 2026-10-19: Points have been edited
+    inline void Changed(void) {
+      bnm_ulRevision = NewNavmeshRevision();
+    };
+
+    // Check if bots can use the NavMesh
+    inline BOOL IsUsable(void) const {
+      return !bnm_bAwaitingSync && bnm_aPoints.Count() > 0;
+    };
 
     // Find next point in the navmesh
-    CBotPathPoint *FindNextPoint(CBotPathPoint *bppSrc, CBotPathPoint *bppDst);
+    CBotPathPoint *FindNextPoint(CBotPathPoint *bppSrc, CBotPathPoint *bppDst, BOOL bUpdateLocks = TRUE);
     CBotPathPoint *ReconstructPath(CPathPoint *ppCurrent);
 
+    // [Cecil] 2026-10-19: Find next point using flow fields shared between bots
+    inline CBotPathPoint *FlowNextPoint(CBotPathPoint *pbppSrc, CBotPathPoint *pbppDst, INDEX ctRequesters) {
+      return bnm_ffsFlow.NextPoint(*this, pbppSrc, pbppDst, ctRequesters);
+    };
+
+    // [Cecil] 2026-10-19: Check which shortest paths towards some point go through any of the points that have just changed their lock states
+    inline void RoutesThrough(CBotPathPoint *pbppDst, CBotPathPoint **apbppSrc, BOOL *abThrough, INDEX ctSrc, CBotPathPoint **apbppChanged, INDEX ctChanged) {
+      bnm_ffsFlow.RoutesThrough(*this, pbppDst, apbppSrc, abThrough, ctSrc, apbppChanged, ctChanged);
+    };
+
     // Constructor & Destructor
     CBotNavmesh(void);
     ~CBotNavmesh(void);
@@ -57,29 +147,91 @@ class DECL_DLL CBotNavmesh {
     void WriteNavmesh(CTStream *strm);
     void ReadNavmesh(CTStream *strm);
 
+    // [Cecil] 2026-10-19: Read points without linking them to the world (safe outside the game thread)
+    void ReadPoints_t(CTStream *strm, SNavmeshProgress *pnp = NULL);
+    // [Cecil] 2026-10-19: Link points that have been read to entities in the world
+    void LinkEntities(CWorld &wo);
+
     // Saving & Loading for a specific world
     void SaveNavmesh(CWorld &wo);
     void LoadNavmesh(CWorld &wo);
 
+    // Read serialized NavMesh and remember it as the base for runtime edits
+    void ReadBase_t(UBYTE *pubData, SLONG slSize, BOOL bOnDisk);
+    // [Cecil] 2026-10-19: Remember serialized NavMesh as the base for runtime edits
+    void SetBase(UBYTE *pubData, SLONG slSize, BOOL bOnDisk);
+    // Restore base NavMesh with a specific checksum from the cache or from the NavMesh file
+    BOOL RestoreBase_t(ULONG ulHash, CWorld &wo);
+
+    // NavMesh state for savegames (full NavMesh or base checksum with runtime edits)
+    void WriteState(CTStream *strm, BOOL bFull);
+    void ReadState(CTStream *strm);
+
     // Clear the navmesh
     void ClearNavmesh(void);
 
     // Add a new path point to the navmesh
     CBotPathPoint *AddPoint(const FLOAT3D &vPoint, CPathPolygon *bppo);
+    // Remove path point from the navmesh
+    void DeletePoint(CBotPathPoint *pbpp);
+    // Update lock states of all points once per tick
+    void UpdateLocks(void);
+    // Lock entity of some point has been changed
+    inline void LocksChanged(void) {
+      bnm_bLocksChanged = TRUE;
+    };
+
+    // Remember the changed lock state to notify listeners after the update
+    void NotifyLockChanged(CBotPathPoint *pbpp);
+
+    // Subscribe to lock state changes
+    void AddLockListener(CLockChangedFunc pFunc, void *pData);
+    void RemoveLockListener(CLockChangedFunc pFunc, void *pData);
+
     // Find a point by its ID
     CBotPathPoint *FindPointByID(INDEX iPoint);
     // Find some important point
     CBotPathPoint *FindImportantPoint(CPlayerBotController &pb, INDEX iPoint);
 
+    // Important points have been added, removed or changed
+    inline void ImportantChanged(void) {
+      bnm_bImportantChanged = TRUE;
+    };
+
+    // Register all important points
+    void UpdateImportant(void);
+    // Update usability of important points that depend on some entity
+    void UpdateImportantEntity(CEntity *pen);
+
     // Generate the NavMesh
     void GenerateNavmesh(CWorld *pwo);
     // Connect all points together
     void ConnectPoints(INDEX iPoint);
     // Remove orphan points
     void CleanupPoints(void);
+
+    // [Cecil] 2026-10-19: Check ground along all connections of a point
+    void CheckLedges(INDEX iPoint);
+    // [Cecil] 2026-10-19: Forget ledges of connections with edited points
+    void ResetEditedLedges(void);
 };
 
+// [Cecil] 2026-10-19: Read the entire file into memory
+void ReadFileData_t(const CTFileName &fnFile, CStaticArray<UBYTE> &aubData);
+
+// [Cecil] 2026-10-19: Get NavMesh file for a specific world
+CTFileName NavmeshFileName(CWorld &wo);
+
+// [Cecil] 2026-10-19: Check if the NavMesh file has a specific checksum
+BOOL NavmeshFileMatches(CWorld &wo, ULONG ulHash);
+
+// [Cecil] 2026-10-19: Notify bots about some important entity becoming (un)usable
+DECL_DLL void CECIL_ImportantEntityChanged(CEntity *pen);
+
 // [Cecil] 2018-10-23: Bot NavMesh
 DECL_DLL extern CBotNavmesh *_pNavmesh;
 
+// [Cecil] 2026-10-19: Replace the global NavMesh with another one
+void ReplaceNavmesh(CBotNavmesh *pbnmNew);
+
 #endif // _CECILBOTS_NAVMESH_H
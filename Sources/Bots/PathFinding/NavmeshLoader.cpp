@@ -0,0 +1,191 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#include "StdH.h"
+#include "NavmeshLoader.h"
+#include "NavmeshTransfer.h"
+
+#include <windows.h>
+
+// [Cecil] 2026-10-19: Navmesh that's currently being loaded
+CNavmeshLoader _nlNavmesh;
+
+// Read points of the loaded navmesh
+static DWORD WINAPI NavmeshLoaderThread(LPVOID pData) {
+  CNavmeshLoader &nl = *(CNavmeshLoader *)pData;
+
+  // Points are only linked to world entities on the game thread
+  try {
+    nl.nl_pbnmLoaded->ReadPoints_t(nl.nl_pstrmData, &nl.nl_np);
+
+  } catch (char *strError) {
+    nl.nl_strError = strError;
+  }
+
+  InterlockedExchange(&nl.nl_bFinished, TRUE);
+  return 0;
+};
+
+// Constructor & Destructor
+CNavmeshLoader::CNavmeshLoader(void) {
+  nl_pstrmData = NULL;
+  nl_ulHash = 0;
+  nl_pbnmLoaded = NULL;
+
+  nl_hThread = NULL;
+  nl_bFinished = FALSE;
+  nl_np.ctRead = 0;
+  nl_np.ctTotal = 0;
+  nl_np.bCancel = FALSE;
+
+  nl_bSent = FALSE;
+};
+
+CNavmeshLoader::~CNavmeshLoader(void) {
+  Clear();
+};
+
+// Start reading the navmesh file of some world
+void CNavmeshLoader::Start_t(CWorld &wo) {
+  Clear();
+
+  // File itself is read on the game thread because engine streams aren't thread-safe
+  const CTFileName fnFile = NavmeshFileName(wo);
+
+  CStaticArray<UBYTE> aubFile;
+  ReadFileData_t(fnFile, aubFile);
+
+  if (aubFile.Count() <= 0) {
+    ThrowF_t("NavMesh file '%s' is empty!", fnFile.str_String);
+  }
+
+  nl_fnFile = fnFile;
+  nl_ulHash = NavmeshDataHash(&aubFile[0], aubFile.Count());
+
+  nl_pstrmData = new CTMemoryStream;
+  nl_pstrmData->Write_t(&aubFile[0], aubFile.Count());
+  nl_pstrmData->SetPos_t(0);
+
+  nl_pbnmLoaded = new CBotNavmesh;
+  nl_pbnmLoaded->bnm_pwoWorld = &wo;
+
+  nl_tvStart = _pTimer->GetHighPrecisionTimer();
+  nl_tvReport = nl_tvStart;
+
+  nl_hThread = CreateThread(NULL, 0, &NavmeshLoaderThread, this, 0, NULL);
+
+  // Read it right away if the thread couldn't be created
+  if (nl_hThread == NULL) {
+    NavmeshLoaderThread(this);
+  }
+};
+
+// Stop reading and forget the navmesh
+void CNavmeshLoader::Clear(void) {
+  // Tell the thread to stop reading and wait until it's done with the current point
+  if (nl_hThread != NULL) {
+    nl_np.bCancel = TRUE;
+    WaitForSingleObject((HANDLE)nl_hThread, INFINITE);
+    CloseHandle((HANDLE)nl_hThread);
+    nl_hThread = NULL;
+  }
+
+  if (nl_pbnmLoaded != NULL) {
+    delete nl_pbnmLoaded;
+    nl_pbnmLoaded = NULL;
+  }
+
+  if (nl_pstrmData != NULL) {
+    delete nl_pstrmData;
+    nl_pstrmData = NULL;
+  }
+
+  nl_fnFile = CTString("");
+  nl_ulHash = 0;
+  nl_bFinished = FALSE;
+  nl_np.ctRead = 0;
+  nl_np.ctTotal = 0;
+  nl_np.bCancel = FALSE;
+  nl_strError = "";
+  nl_bSent = FALSE;
+};
+
+// Report progress and send the navmesh to everyone once it's ready (called on each game tick)
+void CNavmeshLoader::Update(void) {
+  // Nothing to send
+  if (!IsActive() || nl_bSent) {
+    return;
+  }
+
+  const CTimerValue tvNow = _pTimer->GetHighPrecisionTimer();
+
+  // Still reading
+  if (!nl_bFinished) {
+    if ((tvNow - nl_tvReport).GetSeconds() >= NAVMESH_LOAD_REPORT) {
+      nl_tvReport = tvNow;
+
+      const INDEX ctRead = nl_np.ctRead;
+      const INDEX ctTotal = nl_np.ctTotal;
+      const INDEX iPercent = (ctTotal > 0 ? ctRead * 100 / ctTotal : 0);
+
+      CPrintF("Loading NavMesh... %d%% (%d/%d points)\n", iPercent, ctRead, ctTotal);
+    }
+    return;
+  }
+
+  if (nl_hThread != NULL) {
+    WaitForSingleObject((HANDLE)nl_hThread, INFINITE);
+    CloseHandle((HANDLE)nl_hThread);
+    nl_hThread = NULL;
+  }
+
+  if (nl_strError != "") {
+    CPrintF("Cannot load NavMesh for the map: %s\n", nl_strError.str_String);
+    Clear();
+    return;
+  }
+
+  CPrintF("Loaded NavMesh for the current map from '%s' (%d points in %.2fs)\n",
+    nl_fnFile.str_String, nl_np.ctTotal, (tvNow - nl_tvStart).GetSeconds());
+
+  // Everyone switches to the new navmesh at the same point in the game stream
+  CECIL_SendNavmeshData(*nl_pstrmData);
+  nl_bSent = TRUE;
+};
+
+// Replace the global navmesh with the loaded one if it's the same one that has been received
+BOOL CNavmeshLoader::Apply(ULONG ulHash, CWorld &wo) {
+  if (!IsActive() || !nl_bSent || nl_ulHash != ulHash) {
+    return FALSE;
+  }
+
+  CBotNavmesh *pbnm = nl_pbnmLoaded;
+  nl_pbnmLoaded = NULL;
+
+  pbnm->bnm_pwoWorld = &wo;
+  pbnm->LinkEntities(wo);
+
+  // Loaded from the navmesh file
+  UBYTE *pubData;
+  SLONG slSize;
+  nl_pstrmData->LockBuffer(&pubData, &slSize);
+  pbnm->SetBase(pubData, slSize, TRUE);
+  nl_pstrmData->UnlockBuffer();
+
+  ReplaceNavmesh(pbnm);
+  Clear();
+
+  return TRUE;
+};
@@ -0,0 +1,67 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#ifndef _CECILBOTS_NAVMESHLOADER_H
+#define _CECILBOTS_NAVMESHLOADER_H
+
+#include "Navmesh.h"
+
+// How often to report progress of loading a navmesh (in seconds)
+#define NAVMESH_LOAD_REPORT 0.5
+
+// [Cecil] 2026-10-19: Navmesh that's being read from its file outside the game thread
+class DECL_DLL CNavmeshLoader {
+  public:
+    CTFileName nl_fnFile;         // file that's being loaded
+    CTMemoryStream *nl_pstrmData; // contents of the file
+    ULONG nl_ulHash;              // checksum of the file contents
+    CBotNavmesh *nl_pbnmLoaded;   // separate navmesh that the file is read into
+
+    void *nl_hThread;           // thread that's reading the navmesh
+    volatile SLONG nl_bFinished; // thread has finished reading
+    SNavmeshProgress nl_np;     // reading progress
+    CTString nl_strError;       // error that has occurred while reading
+
+    BOOL nl_bSent; // navmesh has been sent to everyone
+    CTimerValue nl_tvStart;  // when loading has been started
+    CTimerValue nl_tvReport; // when progress has been reported the last time
+
+  public:
+    // Constructor & Destructor
+    CNavmeshLoader(void);
+    ~CNavmeshLoader(void);
+
+    // Start reading the navmesh file of some world
+    void Start_t(CWorld &wo);
+
+    // Stop reading and forget the navmesh
+    void Clear(void);
+
+    // Check if currently loading any navmesh
+    inline BOOL IsActive(void) const {
+      return (nl_pbnmLoaded != NULL);
+    };
+
+    // Report progress and send the navmesh to everyone once it's ready (called on each game tick)
+    void Update(void);
+
+    // Replace the global navmesh with the loaded one if it's the same one that has been received
+    BOOL Apply(ULONG ulHash, CWorld &wo);
+};
+
+// [Cecil] 2026-10-19: Navmesh that's currently being loaded
+DECL_DLL extern CNavmeshLoader _nlNavmesh;
+
+#endif // _CECILBOTS_NAVMESHLOADER_H
@@ -0,0 +1,161 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#include "StdH.h"
+#include "NavmeshTransfer.h"
+
+#include "Bots/CustomPackets.h"
+#include "Bots/NetworkPatch/ServerIntegration.h"
+
+#include <Engine/Base/CRC.h>
+#include <Engine/Network/Compression.h>
+
+// [Cecil] 2026-10-19: Navmesh that's currently being received
+CNavmeshTransfer _ntNavmesh;
+
+// Constructor
+CNavmeshTransfer::CNavmeshTransfer(void) {
+  nt_ulHash = 0;
+  nt_slUnpacked = 0;
+  nt_slReceived = 0;
+};
+
+// Start receiving a new navmesh
+void CNavmeshTransfer::Begin(ULONG ulHash, SLONG slPacked, SLONG slUnpacked) {
+  Clear();
+
+  nt_ulHash = ulHash;
+  nt_slUnpacked = slUnpacked;
+  nt_aubPacked.New(slPacked);
+};
+
+// Stop receiving the navmesh
+void CNavmeshTransfer::Clear(void) {
+  nt_ulHash = 0;
+  nt_slUnpacked = 0;
+  nt_slReceived = 0;
+  nt_aubPacked.Clear();
+};
+
+// Receive the next chunk of data (returns TRUE when all data has been received)
+BOOL CNavmeshTransfer::ReceiveChunk_t(CNetworkMessage &nm) {
+  SLONG slOffset, slChunk;
+  nm >> slOffset >> slChunk;
+
+  const SLONG slPacked = nt_aubPacked.Count();
+
+  // Chunks always come in order
+  if (!IsActive() || slOffset != nt_slReceived || slChunk <= 0 || slOffset + slChunk > slPacked) {
+    throw "Received unexpected navmesh data!";
+  }
+
+  nm.Read(&nt_aubPacked[slOffset], slChunk);
+  nt_slReceived += slChunk;
+
+  return (nt_slReceived == slPacked);
+};
+
+// Unpack received data and read it into the navmesh
+void CNavmeshTransfer::Apply_t(CBotNavmesh &bnm, CWorld &wo) {
+  CStaticArray<UBYTE> aubUnpacked;
+  aubUnpacked.New(nt_slUnpacked);
+
+  SLONG slUnpacked = nt_slUnpacked;
+
+  CzlibCompressor comp;
+
+  if (!comp.Unpack(&nt_aubPacked[0], nt_aubPacked.Count(), &aubUnpacked[0], slUnpacked) || slUnpacked != nt_slUnpacked) {
+    throw "Cannot unpack received navmesh data!";
+  }
+
+  // Make sure it's the same navmesh that has been sent
+  if (NavmeshDataHash(&aubUnpacked[0], slUnpacked) != nt_ulHash) {
+    throw "Received navmesh data is corrupted!";
+  }
+
+  // Remember if savegames can restore it from the local NavMesh file
+  const BOOL bOnDisk = NavmeshFileMatches(wo, nt_ulHash);
+
+  bnm.bnm_pwoWorld = &wo;
+  bnm.ReadBase_t(&aubUnpacked[0], slUnpacked, bOnDisk);
+};
+
+// Calculate checksum of serialized navmesh data
+ULONG NavmeshDataHash(UBYTE *pubData, SLONG slSize) {
+  ULONG ulCRC;
+  CRC_Start(ulCRC);
+  CRC_AddBlock(ulCRC, pubData, slSize);
+  CRC_Finish(ulCRC);
+
+  return ulCRC;
+};
+
+// Create a new sandbox action block from the server
+static CCecilStreamBlock NavmeshDataBlock(INDEX iAction) {
+  CServer &srvServer = _pNetwork->ga_srvServer;
+
+  CCecilStreamBlock nsb(MSG_CECIL_SANDBOX, ++srvServer.srv_iLastProcessedSequence);
+  nsb << iAction;
+  nsb << INDEX(-1); // No player
+
+  return nsb;
+};
+
+// Send serialized navmesh to all sessions through the game stream (empty stream clears the navmesh)
+void CECIL_SendNavmeshData(CTMemoryStream &strmNavmesh) {
+  UBYTE *pubData;
+  SLONG slSize;
+  strmNavmesh.LockBuffer(&pubData, &slSize);
+
+  ULONG ulHash = 0;
+  CStaticArray<UBYTE> aubPacked;
+  SLONG slPacked = 0;
+
+  // Compress the navmesh
+  if (slSize > 0) {
+    ulHash = NavmeshDataHash(pubData, slSize);
+
+    CzlibCompressor comp;
+    slPacked = comp.NeededDestinationSize(slSize);
+    aubPacked.New(slPacked);
+
+    if (!comp.Pack(pubData, slSize, &aubPacked[0], slPacked)) {
+      CPrintF("Cannot pack navmesh data for sending!\n");
+      slSize = slPacked = 0;
+    }
+  }
+
+  strmNavmesh.UnlockBuffer();
+
+  // Navmesh header
+  CCecilStreamBlock nsbHeader = NavmeshDataBlock(ESA_NAVMESH_HEADER);
+  nsbHeader << ulHash << slPacked << slSize;
+  CECIL_AddBlockToAllSessions(nsbHeader);
+
+  // Navmesh data in chunks
+  for (SLONG slOffset = 0; slOffset < slPacked; slOffset += NAVMESH_CHUNK_SIZE) {
+    const SLONG slChunk = Min(SLONG(NAVMESH_CHUNK_SIZE), slPacked - slOffset);
+
+    CCecilStreamBlock nsbChunk = NavmeshDataBlock(ESA_NAVMESH_DATA);
+    nsbChunk << slOffset << slChunk;
+    nsbChunk.Write(&aubPacked[slOffset], slChunk);
+
+    CECIL_AddBlockToAllSessions(nsbChunk);
+  }
+
+  if (slSize > 0) {
+    CPrintF("Sending navmesh to all clients (%d bytes, %d packed)\n", slSize, slPacked);
+  }
+};
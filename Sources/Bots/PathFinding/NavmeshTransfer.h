@@ -0,0 +1,63 @@
+/* Copyright (c) 2018-2023 Dreamy Cecil
+This program is free software; you can redistribute it and/or modify
+it under the terms of version 2 of the GNU General Public License as published by
+the Free Software Foundation
+
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License along
+with this program; if not, write to the Free Software Foundation, Inc.,
+51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA. */
+
+#ifndef _CECILBOTS_NAVMESHTRANSFER_H
+#define _CECILBOTS_NAVMESHTRANSFER_H
+
+#include "Navmesh.h"
+
+// Maximum amount of compressed navmesh data in one stream block
+#define NAVMESH_CHUNK_SIZE 1024
+
+// [Cecil] 2026-10-19: Navmesh data that's being received through the game stream
+class DECL_DLL CNavmeshTransfer {
+  public:
+    ULONG nt_ulHash;      // checksum of the unpacked navmesh
+    SLONG nt_slUnpacked;  // size of the unpacked navmesh
+    SLONG nt_slReceived;  // how much packed data has been received so far
+    CStaticArray<UBYTE> nt_aubPacked; // packed navmesh data
+
+  public:
+    // Constructor
+    CNavmeshTransfer(void);
+
+    // Start receiving a new navmesh
+    void Begin(ULONG ulHash, SLONG slPacked, SLONG slUnpacked);
+
+    // Stop receiving the navmesh
+    void Clear(void);
+
+    // Check if currently receiving any navmesh
+    inline BOOL IsActive(void) const {
+      return (nt_aubPacked.Count() > 0);
+    };
+
+    // Receive the next chunk of data (returns TRUE when all data has been received)
+    BOOL ReceiveChunk_t(CNetworkMessage &nm);
+
+    // Unpack received data and read it into the navmesh
+    void Apply_t(CBotNavmesh &bnm, CWorld &wo);
+};
+
+// Calculate checksum of serialized navmesh data
+ULONG NavmeshDataHash(UBYTE *pubData, SLONG slSize);
+
+// Send serialized navmesh to all sessions through the game stream (empty stream clears the navmesh)
+void CECIL_SendNavmeshData(CTMemoryStream &strmNavmesh);
+
+// [Cecil] 2026-10-19: Navmesh that's currently being received
+DECL_DLL extern CNavmeshTransfer _ntNavmesh;
+
+#endif // _CECILBOTS_NAVMESHTRANSFER_H
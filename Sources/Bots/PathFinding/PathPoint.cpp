@@ -38,12 +38,15 @@ void CBotPathPoint::Reset(void) {
   bpp_plLockOrigin = CPlacement3D(FLOAT3D(0.0f, 0.0f, 0.0f), ANGLE3D(0.0f, 0.0f, 0.0f));
 
   bpp_bppoPolygon = NULL;
+  bpp_bEdited = FALSE;
+  bpp_bLocked = FALSE;
 };
 
 // Clear path point
 void CBotPathPoint::Clear(void) {
   // Clear connections
   bpp_cbppPoints.Clear();
+  bpp_aLedges.Clear();
 
   // Destroy the polygon
   if (bpp_bppoPolygon != NULL) {
@@ -94,6 +97,15 @@ void CBotPathPoint::WritePoint(CTStream *strm) {
     *strm << iPoint;
   }
 
+  // [Cecil] 2026-10-19: Write ledge data
+  const INDEX ctLedges = bpp_aLedges.Count();
+  *strm << ctLedges;
+
+  for (INDEX iLedge = 0; iLedge < ctLedges; iLedge++) {
+    *strm << bpp_aLedges[iLedge].iTarget;
+    *strm << bpp_aLedges[iLedge].ulFlags;
+  }
+
   // write the polygon
   *strm << UBYTE(bpp_bppoPolygon != NULL);
 
@@ -102,7 +114,7 @@ void CBotPathPoint::WritePoint(CTStream *strm) {
   }
 };
 
-void CBotPathPoint::ReadPoint(CTStream *strm, INDEX iVersion) {
+void CBotPathPoint::ReadPoint(CTStream *strm, INDEX iVersion, CBotNavmesh &bnm, SPointEntities &pe) {
   INDEX iImportantEntity = -1;
   INDEX iNext = -1;
   INDEX iLockEntity = -1;
@@ -136,6 +148,7 @@ void CBotPathPoint::ReadPoint(CTStream *strm, INDEX iVersion) {
       break;
 
     case 6:
+    case 7:
       *strm >> iLockEntity;
 
       if (iLockEntity != -1) {
@@ -144,19 +157,19 @@ void CBotPathPoint::ReadPoint(CTStream *strm, INDEX iVersion) {
       break;
   }
 
-  // set important entity
-  bpp_penImportant = FindEntityByID(&_pNetwork->ga_World, iImportantEntity);
+  // [Cecil] 2026-10-19: Entities are found after reading all points
+  bpp_penImportant = NULL;
+  bpp_penLock = NULL;
+  pe.iImportant = iImportantEntity;
+  pe.iLock = iLockEntity;
   
   // set next important point
   if (iNext != -1) {
-    bpp_pbppNext = &_pNavmesh->bnm_aPoints[iNext];
+    bpp_pbppNext = &bnm.bnm_aPoints[iNext];
   } else {
     bpp_pbppNext = NULL;
   }
 
-  // set lock entity
-  bpp_penLock = FindEntityByID(&_pNetwork->ga_World, iLockEntity);
-
   // read possible connections
   INDEX ctConnections;
   *strm >> ctConnections;
@@ -165,12 +178,27 @@ void CBotPathPoint::ReadPoint(CTStream *strm, INDEX iVersion) {
     INDEX iPoint;
     *strm >> iPoint;
 
-    CBotPathPoint *pbpp = &_pNavmesh->bnm_aPoints[iPoint];
+    CBotPathPoint *pbpp = &bnm.bnm_aPoints[iPoint];
     bpp_cbppPoints.Add(pbpp);
 
     ctConnections--;
   }
 
+  // [Cecil] 2026-10-19: Read ledge data
+  if (iVersion >= 7) {
+    INDEX ctLedges;
+    *strm >> ctLedges;
+
+    if (ctLedges > 0) {
+      bpp_aLedges.Push(ctLedges);
+    }
+
+    for (INDEX iLedge = 0; iLedge < ctLedges; iLedge++) {
+      *strm >> bpp_aLedges[iLedge].iTarget;
+      *strm >> bpp_aLedges[iLedge].ulFlags;
+    }
+  }
+
   // read the polygon
   UBYTE bPolygon;
   *strm >> bPolygon;
@@ -191,8 +219,8 @@ BOOL CBotPathPoint::IsImportant(void) {
   return (bpp_ulFlags & PPF_IMPORTANT) || ASSERT_ENTITY(bpp_penImportant);
 };
 
-// Check if the point is locked (cannot be passed through)
-BOOL CBotPathPoint::IsLocked(void) {
+// Check if the lock entity is away from its origin
+BOOL CBotPathPoint::LockMoved(void) {
   // no lock entity
   if (!ASSERT_ENTITY(bpp_penLock)) {
     return FALSE;
@@ -224,3 +252,33 @@ void CBotPathPoint::Connect(CBotPathPoint *pbppPoint, INDEX iType) {
     }
   }
 };
+
+// [Cecil] 2026-10-19: Get ledge flags of a connection (0 if they're unknown)
+ULONG CBotPathPoint::GetLedge(const CBotPathPoint *pbppTarget) const {
+  // Ledges of edited points may not match their connections anymore
+  if (bpp_bEdited || pbppTarget->bpp_bEdited) {
+    return 0;
+  }
+
+  for (INDEX iLedge = 0; iLedge < bpp_aLedges.Count(); iLedge++) {
+    if (bpp_aLedges[iLedge].iTarget == pbppTarget->bpp_iIndex) {
+      return bpp_aLedges[iLedge].ulFlags;
+    }
+  }
+
+  return 0;
+};
+
+// [Cecil] 2026-10-19: Set ledge flags of a connection
+void CBotPathPoint::SetLedge(const CBotPathPoint *pbppTarget, ULONG ulFlags) {
+  for (INDEX iLedge = 0; iLedge < bpp_aLedges.Count(); iLedge++) {
+    if (bpp_aLedges[iLedge].iTarget == pbppTarget->bpp_iIndex) {
+      bpp_aLedges[iLedge].ulFlags = ulFlags;
+      return;
+    }
+  }
+
+  SPointLedge &pl = bpp_aLedges.Push();
+  pl.iTarget = pbppTarget->bpp_iIndex;
+  pl.ulFlags = ulFlags;
+};
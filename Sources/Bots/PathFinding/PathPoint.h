@@ -27,6 +27,25 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #define PPF_TELEPORT    (1 << 5) // Acts as a teleport and has 0 distance to any target point
 #define PPF_IMPORTANT   (1 << 6) // This point is significant for one reason or another
 
+// [Cecil] 2026-10-19: Connection Ledge Flags (rearranging them can break previously created NavMeshes)
+#define PLF_CHECKED (1 << 0) // Ground along the connection has been checked
+#define PLF_PIT     (1 << 1) // There's a bottomless pit somewhere along the connection
+#define PLF_MOVING  (1 << 2) // Ground along the connection belongs to a moving brush
+
+// [Cecil] 2026-10-19: Ledge data of one connection
+struct SPointLedge {
+  INDEX iTarget; // ID of the connected point
+  ULONG ulFlags; // ledge flags
+};
+
+// [Cecil] 2026-10-19: Entity IDs of a point that hasn't been linked to the world yet
+struct SPointEntities {
+  INDEX iImportant; // ID of the important entity
+  INDEX iLock; // ID of the lock entity
+};
+
+class CBotNavmesh;
+
 // [Cecil] 2018-10-22: Bot Path Points
 class DECL_DLL CBotPathPoint {
   public:
@@ -48,6 +67,15 @@ class DECL_DLL CBotPathPoint {
     // Possible connections
     CDynamicContainer<CBotPathPoint> bpp_cbppPoints;
 
+    // Point has been edited since the navmesh has been loaded
+    BOOL bpp_bEdited;
+
+    // Lock state from the last navmesh update
+    BOOL bpp_bLocked;
+
+    // [Cecil] 2026-10-19: Ledge data of connections computed during generation
+    CStaticStackArray<SPointLedge> bpp_aLedges;
+
   public:
     // Constructor & Destructor
     CBotPathPoint(void);
@@ -61,7 +89,8 @@ class DECL_DLL CBotPathPoint {
 
     // Writing & Reading
     void WritePoint(CTStream *strm);
-    void ReadPoint(CTStream *strm, INDEX iVersion);
+    // [Cecil] 2026-10-19: Point is read into a specific NavMesh and entities are linked separately
+    void ReadPoint(CTStream *strm, INDEX iVersion, CBotNavmesh &bnm, SPointEntities &pe);
 
     // Path points comparison
     BOOL operator==(const CBotPathPoint &bppOther) const;
@@ -70,10 +99,21 @@ class DECL_DLL CBotPathPoint {
     BOOL IsImportant(void);
 
     // Check if the point is locked (cannot be passed through)
-    BOOL IsLocked(void);
+    inline BOOL IsLocked(void) const {
+      return bpp_bLocked;
+    };
+
+    // Check if the lock entity is away from its origin
+    BOOL LockMoved(void);
 
     // Make a connection with a specific point
     void Connect(CBotPathPoint *pbppPoint, INDEX iType);
+
+    // [Cecil] 2026-10-19: Get ledge flags of a connection (0 if they're unknown)
+    ULONG GetLedge(const CBotPathPoint *pbppTarget) const;
+
+    // [Cecil] 2026-10-19: Set ledge flags of a connection
+    void SetLedge(const CBotPathPoint *pbppTarget, ULONG ulFlags);
 };
 
 // [Cecil] Path points in open and closed lists (only for path finding)
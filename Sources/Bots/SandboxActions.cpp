@@ -19,10 +19,15 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 
 #include "CustomPackets.h"
 #include "Bots/NetworkPatch/ServerIntegration.h"
+#include "Bots/PathFinding/NavmeshTransfer.h"
+#include "Bots/PathFinding/NavmeshLoader.h"
 
 // [Cecil] 2021-06-18: For weapon switching
 #include "EntitiesMP/PlayerMarker.h"
 
+// [Cecil] 2026-10-19: For path finding benchmarks
+#include "EntitiesMP/Common/PathFinding.h"
+
 // [Cecil] 2021-06-19: Render entity IDs
 extern INDEX MOD_bEntityIDs = FALSE;
 
@@ -35,6 +40,14 @@ extern INDEX MOD_bBotThoughts = FALSE;
 // Check for class names, rather than DLL classes
 extern INDEX MOD_bCheckClassNames = FALSE;
 
+// [Cecil] 2026-10-19: Report time spent by enemy spawners on each group
+extern INDEX MOD_bSpawnerTiming = FALSE;
+
+// [Cecil] 2026-10-19: How many short-lived entities have been reused, created anew and destroyed to make room
+extern INDEX MOD_ctRecycleHits = 0;
+extern INDEX MOD_ctRecycleMisses = 0;
+extern INDEX MOD_ctRecycleEvictions = 0;
+
 // [Cecil] 2019-06-02: Bot names and skins
 static CStaticStackArray<CTString> BOT_astrNames;
 static CStaticStackArray<CTString> BOT_astrSkins;
@@ -51,6 +64,9 @@ static CTString BOT_strSpawnTeam = ""; // team to spawn in
 // [Cecil] 2020-07-28: A structure with current bot settings
 static SBotSettings _sbsBotSettings;
 
+// [Cecil] 2026-10-19: How many queued bots can be added per game tick
+static INDEX BOT_iSpawnsPerTick = 2;
+
 // [Cecil] 2019-11-07: Special client packet for NavMesh editing
 static CNetworkMessage CECIL_NavMeshClientPacket(const INDEX &iAction) {
   NEW_PACKET(nmNavmesh, MSG_CECIL_SANDBOX);
@@ -211,8 +227,10 @@ static void CECIL_QuickBots(INDEX ctBots) {
   const CTString strName = BOT_strSpawnName;
 
   // Create message for adding multiple bots
-  CCecilStreamBlock nsbAddBots = CECIL_BotServerPacket(ESA_ADDBOTS);
+  // [Cecil] 2026-10-19: Add them over multiple ticks
+  CCecilStreamBlock nsbAddBots = CECIL_BotServerPacket(ESA_QUEUEBOTS);
   nsbAddBots << _sbsBotSettings; // Update bot settings
+  nsbAddBots << BOT_iSpawnsPerTick; // Spawning budget
   nsbAddBots << ctBots; // Amount of bots
 
   for (INDEX i = 0; i < ctBots; i++) {
@@ -352,6 +370,35 @@ static void CECIL_BotTeleport(void) {
   CECIL_AddBlockToAllSessions(nsbBotUpdate);
 };
 
+// [Cecil] 2026-10-19: Print recent thoughts of all bots
+static void CECIL_DumpBotThoughts(void) {
+  CPrintF(MODCOM_NAME("DumpBotThoughts:\n"));
+
+  if (!MOD_bBotThoughts) {
+    CPrintF("  <bot thoughts are disabled>\n");
+    return;
+  }
+
+  CTString strThought;
+
+  for (INDEX iBot = 0; iBot < _aPlayerBots.Count(); iBot++) {
+    CPlayerBot *penBot = (CPlayerBot *)_aPlayerBots[iBot].pen;
+
+    if (!ASSERT_ENTITY(penBot)) {
+      continue;
+    }
+
+    const SBotThoughts &btThoughts = penBot->GetProps().m_btThoughts;
+    CPrintF("%s^r:\n", penBot->GetPlayerName());
+
+    // From the oldest to the newest
+    for (INDEX iThought = btThoughts.ctThoughts - 1; iThought >= 0; iThought--) {
+      btThoughts.Format(iThought, strThought);
+      CPrintF("  %s^r\n", strThought);
+    }
+  }
+};
+
 // [Cecil] 2021-06-18: Change all weapons
 static void CECIL_SetWeapons(INDEX iWeapon, INDEX bPlayer) {
   CPrintF(MODCOM_NAME("SetWeapons:\n"));
@@ -413,8 +460,20 @@ BOOL LoadNavMeshPacket(void) {
     return FALSE;
   }
 
-  CCecilStreamBlock nsbNavMesh = CECIL_BotServerPacket(ESA_NAVMESH_LOAD);
-  CECIL_AddBlockToAllSessions(nsbNavMesh);
+  CWorld &wo = _pNetwork->ga_World;
+
+  // [Cecil] 2026-10-19: Only the server reads the navmesh file and sends it to everyone
+  // [Cecil] 2026-10-19: It's sent after being read in the background
+  try {
+    _nlNavmesh.Start_t(wo);
+
+  } catch (char *strError) {
+    CPrintF("%s\n", strError);
+
+    // Empty navmesh data makes everyone clear it
+    CTMemoryStream strmNavmesh;
+    CECIL_SendNavmeshData(strmNavmesh);
+  }
 
   return TRUE;
 };
@@ -702,15 +761,30 @@ extern void CECIL_InitSandboxActions(void) {
   _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("bEntityIDs;"), &MOD_bEntityIDs);
   _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("bClientSandbox;"), &MOD_bClientSandbox);
   _pShell->DeclareSymbol("persistent user INDEX " MODCOM_NAME("bBotThoughts;"), &MOD_bBotThoughts);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("DumpBotThoughts(void);"), &CECIL_DumpBotThoughts);
 
   _pShell->DeclareSymbol("user void " MODCOM_NAME("SetWeapons(INDEX, INDEX);"), &CECIL_SetWeapons);
 
   _pShell->DeclareSymbol("persistent user INDEX " MODCOM_NAME("bCheckClassNames;"), &MOD_bCheckClassNames);
 
+  // [Cecil] 2026-10-19: Benchmarks
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("EmiterBenchmark(INDEX);"), &CECIL_EmiterBenchmark);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("GrowthBenchmark(INDEX);"), &CECIL_GrowthBenchmark);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("PathBenchmark(INDEX);"), &CECIL_PathBenchmark);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("MarkerBenchmark(INDEX);"), &CECIL_MarkerBenchmark);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("FlowFieldBenchmark(INDEX);"), &CECIL_FlowFieldBenchmark);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("WeaponTableCheck(INDEX);"), &CECIL_WeaponTableCheck);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("CheckWorldCounts(void);"), &CECIL_CheckWorldCounts);
+  _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("bSpawnerTiming;"), &MOD_bSpawnerTiming);
+  _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("ctRecycleHits;"), &MOD_ctRecycleHits);
+  _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("ctRecycleMisses;"), &MOD_ctRecycleMisses);
+  _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("ctRecycleEvictions;"), &MOD_ctRecycleEvictions);
+
   // [Cecil] Bot editing
   _pShell->DeclareSymbol("user CTString " BOTCOM_NAME("strBotEdit;"), &BOT_strBotEdit);
   _pShell->DeclareSymbol("persistent user CTString " BOTCOM_NAME("strSpawnName;"), &BOT_strSpawnName);
   _pShell->DeclareSymbol("persistent user CTString " BOTCOM_NAME("strSpawnTeam;"), &BOT_strSpawnTeam);
+  _pShell->DeclareSymbol("persistent user INDEX " BOTCOM_NAME("iSpawnsPerTick;"), &BOT_iSpawnsPerTick);
 
   _pShell->DeclareSymbol("user void " BOTCOM_NAME("ResetBotConfig(INDEX);"), &CECIL_ResetBotConfig);
   _pShell->DeclareSymbol("persistent user INDEX " BOTCOM_NAME("b3rdPerson;"      ), &_sbsBotSettings.b3rdPerson);
@@ -758,6 +832,7 @@ extern void CECIL_InitSandboxActions(void) {
   _pShell->DeclareSymbol("persistent user INDEX " MODCOM_NAME("bOnlyCurrentConnections;"), &MOD_bOnlyCurrentConnections);
   _pShell->DeclareSymbol("persistent user FLOAT " MODCOM_NAME("fNavMeshRenderRange;"), &MOD_fNavMeshRenderRange);
   _pShell->DeclareSymbol("persistent user INDEX " MODCOM_NAME("iNavMeshRangeModel;"), &MOD_iNavMeshRangeModel);
+  _pShell->DeclareSymbol("persistent user INDEX " MODCOM_NAME("iNavMeshLabels;"), &MOD_iNavMeshLabels);
   _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("iNavMeshPoint;"), &MOD_iNavMeshPoint);
   _pShell->DeclareSymbol("user INDEX " MODCOM_NAME("iNavMeshConnecting;"), &MOD_iNavMeshConnecting);
 
@@ -856,11 +931,128 @@ static void AddBotWithCharacter(CWorld &wo, CPlayerCharacter &pcBot, const SBotS
   }
 };
 
+// [Cecil] 2026-10-19: Bot that's waiting to be added
+struct SQueuedBot {
+  CPlayerCharacter pc;
+  SBotSettings sbs;
+};
+
+// [Cecil] 2026-10-19: Bots that are added over multiple ticks
+static CStaticStackArray<SQueuedBot> _aBotQueue;
+static INDEX _iBotQueueNext = 0; // next bot to add
+static INDEX _ctBotQueueBudget = 1; // bots per tick (synchronized from the server)
+
+// [Cecil] 2026-10-19: Models for preloading resources of queued bots
+#define BOT_PRELOAD_SLOTS 8
+
+static CStaticArray<CModelObject> _amoBotPreload;
+static INDEX _iBotQueuePreloaded = 0; // next bot to preload
+
+// Preload model and textures of the next queued bot (called on each rendered frame outside game ticks)
+void CECIL_PreloadBotQueue(void) {
+  // Doesn't affect the game state, so it's fine to do it only locally
+  _iBotQueuePreloaded = Max(_iBotQueuePreloaded, _iBotQueueNext);
+
+  // Nothing to preload or too far ahead of added bots
+  if (_iBotQueuePreloaded >= _aBotQueue.Count() || _iBotQueuePreloaded >= _iBotQueueNext + BOT_PRELOAD_SLOTS) {
+    return;
+  }
+
+  if (_amoBotPreload.Count() == 0) {
+    _amoBotPreload.New(BOT_PRELOAD_SLOTS);
+  }
+
+  // Reuse the slot of a bot that has already been added
+  CModelObject &mo = _amoBotPreload[_iBotQueuePreloaded % BOT_PRELOAD_SLOTS];
+
+  CTString strDummy;
+  SetPlayerAppearance(&mo, &_aBotQueue[_iBotQueuePreloaded].pc, strDummy, FALSE);
+  _iBotQueuePreloaded++;
+};
+
+// Clear queued bots
+void CECIL_ClearBotQueue(void) {
+  _aBotQueue.PopAll();
+  _iBotQueueNext = 0;
+  _ctBotQueueBudget = 1;
+  _amoBotPreload.Clear();
+  _iBotQueuePreloaded = 0;
+};
+
+// Add a few queued bots (called on each game tick on every machine)
+void CECIL_ProcessBotQueue(void) {
+  if (_iBotQueueNext >= _aBotQueue.Count()) {
+    return;
+  }
+
+  CWorld &wo = _pNetwork->ga_World;
+
+  // Delete all predictors
+  wo.DeletePredictors();
+
+  // Queue has just started
+  if (_iBotQueueNext == 0) {
+    CPutString(TRANS("Added bots:\n"));
+  }
+
+  const INDEX iLast = Min(_iBotQueueNext + _ctBotQueueBudget, _aBotQueue.Count());
+
+  for (; _iBotQueueNext < iLast; _iBotQueueNext++) {
+    SQueuedBot &qb = _aBotQueue[_iBotQueueNext];
+    AddBotWithCharacter(wo, qb.pc, qb.sbs);
+  }
+
+  // Queue is over
+  if (_iBotQueueNext >= _aBotQueue.Count()) {
+    CECIL_ClearBotQueue();
+  }
+};
+
+// Write queued bots
+void CECIL_WriteBotQueue(CTStream &strm) {
+  strm.WriteID_t("BQUE");
+  strm << _ctBotQueueBudget;
+  strm << INDEX(_aBotQueue.Count() - _iBotQueueNext);
+
+  for (INDEX i = _iBotQueueNext; i < _aBotQueue.Count(); i++) {
+    SQueuedBot &qb = _aBotQueue[i];
+    qb.pc.Write_t(&strm);
+    strm << qb.sbs;
+  }
+};
+
+// Read queued bots
+void CECIL_ReadBotQueue(CTStream &strm) {
+  CECIL_ClearBotQueue();
+
+  // Saved without the queue
+  if (strm.PeekID_t() != CChunkID("BQUE")) {
+    return;
+  }
+
+  strm.ExpectID_t("BQUE");
+  strm >> _ctBotQueueBudget;
+
+  INDEX ctQueued;
+  strm >> ctQueued;
+
+  for (INDEX i = 0; i < ctQueued; i++) {
+    SQueuedBot &qb = _aBotQueue.Push();
+    qb.pc.Read_t(&strm);
+    strm >> qb.sbs;
+  }
+};
+
 // Receive and perform a sandbox action
 void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nmMessage) {
   BOOL bLocal = _pNetwork->IsPlayerLocal(pen);
   CWorld &wo = _pNetwork->ga_World;
 
+  // [Cecil] 2026-10-19: NavMesh might get edited
+  if (iAction >= ESA_NAVMESH_GEN && iAction != ESA_QUEUEBOTS) {
+    _pNavmesh->Changed();
+  }
+
   switch (iAction) {
     // Add a new bot to the game
     case ESA_ADDBOT: {
@@ -898,6 +1090,25 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
       }
     } break;
 
+    // [Cecil] 2026-10-19: Queue bots to add them over multiple ticks
+    case ESA_QUEUEBOTS: {
+      SBotSettings sbsSettings;
+      nmMessage >> sbsSettings;
+
+      INDEX ctBudget;
+      nmMessage >> ctBudget;
+      _ctBotQueueBudget = ClampDn(ctBudget, (INDEX)1);
+
+      INDEX ctBots;
+      nmMessage >> ctBots;
+
+      for (INDEX i = 0; i < ctBots; i++) {
+        SQueuedBot &qb = _aBotQueue.Push();
+        nmMessage >> qb.pc;
+        qb.sbs = sbsSettings;
+      }
+    } break;
+
     // [Cecil] 2021-06-12: Remove the bot
     case ESA_REMBOT: {
       INDEX iBot;
@@ -1013,6 +1224,9 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
       INDEX iPoints;
       nmMessage >> iPoints;
 
+      // [Cecil] 2026-10-19: Don't replace new points with the NavMesh that's being loaded
+      _nlNavmesh.Clear();
+
       if (iPoints) {
         CTFileName fnClass = CTString("Classes\\NavMeshGenerator.ecl");
         CEntity *penNew = wo.CreateEntity_t(CPlacement3D(FLOAT3D(0, 0, 0), ANGLE3D(0, 0, 0)), fnClass);
@@ -1024,16 +1238,26 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
           CPrintF("[NavMeshGenerator]: NavMesh has been cleared\n");
 
         } else {
-          CPrintF("[NavMeshGenerator]: Generating points...\n");
-          _pNavmesh->GenerateNavmesh(&wo);
-          _pNavmesh->bnm_bGenerated = TRUE;
+          // [Cecil] 2026-10-19: Only the server generates points and then sends them to everyone
+          _pNavmesh->ClearNavmesh();
+          _pNavmesh->bnm_bAwaitingSync = TRUE;
+
+          if (_pNetwork->IsServer()) {
+            CPrintF("[NavMeshGenerator]: Generating points...\n");
+            _pNavmesh->GenerateNavmesh(&wo);
+            _pNavmesh->bnm_bGenerated = TRUE;
+
+            CTMemoryStream strmNavmesh;
+            _pNavmesh->WriteNavmesh(&strmNavmesh);
+            CECIL_SendNavmeshData(strmNavmesh);
+          }
         }
       }
     } break;
 
     // NavMesh state
     case ESA_NAVMESH_LOAD: {
-      // Load the NavMesh
+      // [Cecil] 2026-10-19: Only sent by older versions that loaded the NavMesh file on every machine
       try {
         _pNavmesh->LoadNavmesh(wo);
 
@@ -1042,10 +1266,53 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         _pNavmesh->ClearNavmesh();
       }
     } break;
+
+    // [Cecil] 2026-10-19: NavMesh transfer from the server
+    case ESA_NAVMESH_HEADER: {
+      ULONG ulHash;
+      SLONG slPacked, slUnpacked;
+      nmMessage >> ulHash >> slPacked >> slUnpacked;
+
+      // [Cecil] 2026-10-19: No navmesh on the server
+      if (slPacked <= 0) {
+        _ntNavmesh.Clear();
+        _pNavmesh->ClearNavmesh();
+        _pNavmesh->bnm_bAwaitingSync = FALSE;
+        break;
+      }
+
+      // Bots can't use the navmesh until all of it has been received
+      _ntNavmesh.Begin(ulHash, slPacked, slUnpacked);
+      _pNavmesh->bnm_bAwaitingSync = TRUE;
+    } break;
+
+    // [Cecil] 2026-10-19: NavMesh data from the server
+    case ESA_NAVMESH_DATA: {
+      try {
+        if (!_ntNavmesh.ReceiveChunk_t(nmMessage)) {
+          break;
+        }
+
+        // [Cecil] 2026-10-19: Switch to the NavMesh that has already been read in the background
+        if (!_nlNavmesh.Apply(_ntNavmesh.nt_ulHash, wo)) {
+          // Load the NavMesh
+          _ntNavmesh.Apply_t(*_pNavmesh, wo);
+          CPrintF("Received NavMesh for the current map from the server\n");
+        }
+
+      } catch (char *strError) {
+        CPrintF("%s\n", strError);
+        _pNavmesh->ClearNavmesh();
+      }
+
+      _ntNavmesh.Clear();
+      _pNavmesh->bnm_bAwaitingSync = FALSE;
+    } break;
     
     // NavMesh clearing
     case ESA_NAVMESH_CLEAR: {
       CPrintF("NavMesh has been cleared\n");
+      _nlNavmesh.Clear();
       _pNavmesh->ClearNavmesh();
     } break;
 
@@ -1071,6 +1338,7 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
       }
 
       CBotPathPoint *pbppNext = _pNavmesh->AddPoint(vPoint, NULL);
+      pbppNext->bpp_bEdited = TRUE;
 
       // Connect with the previous point like in a chain
       if (iConnect > 0) {
@@ -1078,6 +1346,7 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
 
         if (pbppPrev != NULL) {
           pbppPrev->Connect(pbppNext, iConnect);
+          pbppPrev->bpp_bEdited = TRUE;
         }
       }
 
@@ -1091,18 +1360,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
       CBotPathPoint *pbpp = _pNavmesh->FindPointByID(iCurrentPoint);
 
       if (pbpp != NULL) {
-        // Remove this point from every connection
-        for (INDEX iPoint = 0; iPoint < _pNavmesh->bnm_aPoints.Count(); iPoint++) {
-          CBotPathPoint *pbppCheck = _pNavmesh->bnm_aPoints.Pointer(iPoint);
-
-          // Remove connection with this point
-          if (pbppCheck->bpp_cbppPoints.IsMember(pbpp)) {
-            pbppCheck->bpp_cbppPoints.Remove(pbpp);
-          }
-        }
-
         // Remove point from the NavMesh
-        _pNavmesh->bnm_aPoints.Delete(pbpp);
+        _pNavmesh->DeletePoint(pbpp);
 
         MOD_iNavMeshPoint = -1;
       }
@@ -1123,6 +1382,12 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CBotPathPoint *pbppTarget = _pNavmesh->FindPointByID(iTargetPoint);
         pbpp->Connect(pbppTarget, iConnect);
 
+        pbpp->bpp_bEdited = TRUE;
+
+        if (pbppTarget != NULL) {
+          pbppTarget->bpp_bEdited = TRUE;
+        }
+
         CPrintF("Connected points %d and %d (type: %d)\n", iCurrentPoint, iTargetPoint, iConnect);
       }
     } break;
@@ -1141,6 +1406,7 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
 
         if (pbpp->bpp_cbppPoints.IsMember(pbppTarget)) {
           pbpp->bpp_cbppPoints.Remove(pbppTarget);
+          pbpp->bpp_bEdited = TRUE;
           CPrintF("Untargeted point %d from %d\n", iTargetPoint, iCurrentPoint);
 
         } else {
@@ -1166,6 +1432,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         FLOAT3D vLastPos = pbpp->bpp_vPos;
         pbpp->bpp_vPos = pen->GetPlacement().pl_PositionVector + FLOAT3D(0.0f, fOffset, 0.0f) * pen->GetRotationMatrix();
 
@@ -1186,6 +1454,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         FLOAT3D vLastPos = pbpp->bpp_vPos;
         pbpp->bpp_vPos = FLOAT3D(fX, fY, fZ);
 
@@ -1206,6 +1476,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         FLOAT3D vLastPos = pbpp->bpp_vPos;
 
         for (INDEX iPos = 1; iPos <= 3; iPos++) {
@@ -1228,9 +1500,13 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         ULONG ulOldFlags = pbpp->bpp_ulFlags;
         pbpp->bpp_ulFlags = ulNewFlags;
 
+        _pNavmesh->ImportantChanged();
+
         CPrintF("Point's flags: %s -> %s\n", ULongToBinary(ulOldFlags), ULongToBinary(ulNewFlags));
       }
     } break;
@@ -1245,6 +1521,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         CEntity *penImportant = FindEntityByID(&wo, iEntityID);
 
         if (penImportant != NULL) {
@@ -1255,6 +1533,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
           pbpp->bpp_penImportant = NULL;
           CPrintF("Reset point's entity (entity under ID %d doesn't exist)\n", iEntityID);
         }
+
+        _pNavmesh->ImportantChanged();
       }
     } break;
 
@@ -1270,6 +1550,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         FLOAT fOldRange = pbpp->bpp_fRange;
         pbpp->bpp_fRange = fRange;
 
@@ -1287,6 +1569,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         INDEX iLastNext = (pbpp->bpp_pbppNext == NULL) ? -1 : pbpp->bpp_pbppNext->bpp_iIndex;
         pbpp->bpp_pbppNext = _pNavmesh->FindPointByID(iNextPoint);
 
@@ -1305,6 +1589,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
         CPrintF("NavMesh point doesn't exist!\n");
 
       } else {
+        pbpp->bpp_bEdited = TRUE;
+
         CEntity *penLock = FindEntityByID(&wo, iEntityID);
 
         if (penLock != NULL) {
@@ -1317,6 +1603,8 @@ void CECIL_SandboxAction(CPlayer *pen, const INDEX &iAction, CNetworkMessage &nm
           pbpp->bpp_penLock = NULL;
           CPrintF("Reset point's lock entity (entity under ID %d doesn't exist)\n", iEntityID);
         }
+
+        _pNavmesh->LocksChanged();
       }
     } break;
 
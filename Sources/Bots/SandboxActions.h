@@ -26,4 +26,11 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 // Receive and perform a sandbox action
 void CECIL_SandboxAction(class CPlayer *pen, const INDEX &iAction, CNetworkMessage &nmMessage);
 
+// [Cecil] 2026-10-19: Queue of bots that are added over multiple ticks
+void CECIL_ClearBotQueue(void);
+void CECIL_ProcessBotQueue(void);
+void CECIL_WriteBotQueue(CTStream &strm);
+void CECIL_ReadBotQueue(CTStream &strm);
+void CECIL_PreloadBotQueue(void);
+
 #endif // _CECILBOTS_SANDBOXACTIONS_H
@@ -22,6 +22,8 @@ with this program; if not, write to the Free Software Foundation, Inc.,
 #include "Bots/Hotkeys.h"
 
 #include "Bots/BotModMain.h"
+#include "Bots/BotProfile.h"
+#include "Bots/BotBenchmark.h"
 #include "Bots/PathFinding/Navmesh.h"
 
 // [Cecil] 2021-06-11: Player bot
@@ -239,8 +239,12 @@ properties:
  41 FLOAT m_tmWhenShot = 0.0f, // when entity was shot
  42 FLOAT3D m_vGravity = FLOAT3D(0,0,0), // simulated direction of gravity
 
+ 50 BOOL m_bRecyclable = FALSE, // [Cecil] 2026-10-19: can be reused after finishing
+ 51 INDEX m_iRecycled = 0,      // [Cecil] 2026-10-19: order of finishing while waiting to be reused
+
 {
   CLightSource m_lsLightSource;
+  CRecycleLink m_rlPool; // [Cecil] 2026-10-19: link in the pool of finished effects
 }
 
 components:
@@ -323,6 +327,12 @@ components:
 
 functions:
 
+  // [Cecil] 2026-10-19: Constructor
+  void CBasicEffect(void)
+  {
+    m_rlPool.Init(this, ERK_BASICEFFECT, &m_iRecycled);
+  }
+
   // dump sync data to text file
   export void DumpSync_t(CTStream &strm, INDEX iExtensiveSyncCheck)  // throw char *
   {
@@ -338,6 +348,28 @@ functions:
     if( m_bLightSource) {
       SetupLightSource();
     }
+
+    // [Cecil] 2026-10-19: Wait to be reused again
+    if (m_iRecycled > 0) {
+      m_rlPool.Relink();
+    }
+  }
+
+  // [Cecil] 2026-10-19: Wait to be reused instead of being destroyed, if possible
+  void Finish(void)
+  {
+    if (!m_bRecyclable || IsPredictor()) {
+      Destroy();
+      return;
+    }
+
+    // hide it until it's reused
+    SetParent(NULL);
+    SetFlags(GetFlags() & ~ENF_SEETHROUGH);
+    m_bLightSource = FALSE;
+    InitAsVoid();
+
+    m_rlPool.Park();
   }
 
   /* Get static light source information. */
@@ -1433,7 +1465,7 @@ procedures:
     }
 
     // cease to exist
-    Destroy();
+    Finish(); // [Cecil] 2026-10-19
     return;
   }
 
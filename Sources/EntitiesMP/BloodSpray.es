@@ -34,6 +34,12 @@ properties:
   12 COLOR m_colCentralColor = COLOR(C_WHITE|CT_OPAQUE),
   13 FLOATaabbox3D m_boxOriginalOwner = FLOATaabbox3D(FLOAT3D(0,0,0), 0.01f),
   14 COLOR m_colBurnColor = COLOR(C_WHITE|CT_OPAQUE),
+  15 BOOL m_bRecyclable = FALSE, // [Cecil] 2026-10-19: can be reused after finishing
+  16 INDEX m_iRecycled = 0,      // [Cecil] 2026-10-19: order of finishing while waiting to be reused
+
+{
+  CRecycleLink m_rlPool; // [Cecil] 2026-10-19: link in the pool of finished sprays
+}
 
 
 components:
@@ -42,6 +48,40 @@ components:
 
 functions:
 
+  // [Cecil] 2026-10-19: Constructor
+  void CBloodSpray(void)
+  {
+    m_rlPool.Init(this, ERK_BLOODSPRAY, &m_iRecycled);
+  }
+
+  // [Cecil] 2026-10-19: Wait to be reused again
+  void Read_t(CTStream *istr) // throw char *
+  {
+    CRationalEntity::Read_t(istr);
+
+    if (m_iRecycled > 0) {
+      m_rlPool.Relink();
+    }
+  }
+
+  // [Cecil] 2026-10-19: Wait to be reused instead of being destroyed, if possible
+  void Finish(void)
+  {
+    if (!m_bRecyclable || IsPredictor()) {
+      Destroy();
+      return;
+    }
+
+    // hide it until it's reused
+    SetParent(NULL);
+    InitAsVoid();
+
+    // don't keep other entities while waiting
+    m_penOwner = NULL;
+
+    m_rlPool.Park();
+  }
+
   // particles
   void RenderParticles(void)
   {
@@ -131,7 +171,7 @@ procedures:
     if( eSpawn.penOwner==NULL || eSpawn.penOwner->en_pmoModelObject == NULL)
     {
       // don't do anything
-      Destroy();
+      Finish(); // [Cecil] 2026-10-19
       return;
     }
 
@@ -159,7 +199,7 @@ procedures:
       fWaitTime = 4.0f;
     }
     autowait(fWaitTime);
-    Destroy();
+    Finish(); // [Cecil] 2026-10-19
 
     return;
   }
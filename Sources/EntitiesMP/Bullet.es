@@ -120,130 +120,17 @@ functions:
   // launch one bullet
   void LaunchBullet(BOOL bSound, BOOL bTrail, BOOL bHitFX)
   {
-    // cast a ray to find bullet target
-    CCastRay crRay( m_penOwner, GetPlacement().pl_PositionVector, m_vTarget);
-    crRay.cr_bHitPortals = TRUE;
-    crRay.cr_bHitTranslucentPortals = TRUE;
-    crRay.cr_ttHitModels = CCastRay::TT_COLLISIONBOX;
-    crRay.cr_bPhysical = FALSE;
-    crRay.cr_fTestR = m_fBulletSize;
-    FLOAT3D vHitDirection;
-    AnglesToDirectionVector(GetPlacement().pl_OrientationAngle, vHitDirection);
+    // [Cecil] Cast the ray through the hitscan bullet
+    CHitscanBullet hb(m_penOwner, GetPlacement(), m_fDamage);
+    hb.hb_dmtDamage = m_EdtDamage;
+    hb.hb_fBulletSize = m_fBulletSize;
+    hb.hb_vTarget = m_vTarget;
+    hb.hb_vTargetCopy = m_vTargetCopy;
+    hb.hb_vHitPoint = m_vHitPoint;
 
-    INDEX ctCasts = 0;
-    while( ctCasts<10)
-    {
-      if(ctCasts == 0)
-      {
-        // perform first cast
-        GetWorld()->CastRay(crRay);       
-      }
-      else
-      {
-        // next casts
-        GetWorld()->ContinueCast(crRay);
-      }
-      ctCasts++;
+    hb.Launch(bSound, bTrail);
 
-      // stop casting if nothing hit
-      if (crRay.cr_penHit==NULL)
-      {
-        break;
-      }
-      // apply damage
-      const FLOAT fDamageMul = GetSeriousDamageMultiplier(m_penOwner);
-      InflictDirectDamage(crRay.cr_penHit, m_penOwner, m_EdtDamage, m_fDamage*fDamageMul,
-                            crRay.cr_vHit, vHitDirection);
-
-      m_vHitPoint = crRay.cr_vHit;
-
-      // if brush hitted
-      if (crRay.cr_penHit->GetRenderType()==RT_BRUSH && crRay.cr_pbpoBrushPolygon!=NULL)
-      {
-        CBrushPolygon *pbpo = crRay.cr_pbpoBrushPolygon;
-        FLOAT3D vHitNormal = FLOAT3D(pbpo->bpo_pbplPlane->bpl_plAbsolute);
-        // obtain surface type
-        INDEX iSurfaceType = pbpo->bpo_bppProperties.bpp_ubSurfaceType;
-        BulletHitType bhtType = BHT_BRUSH_STONE;
-        // get content type
-        INDEX iContent = pbpo->bpo_pbscSector->GetContentType();
-        CContentType &ct = GetWorld()->wo_actContentTypes[iContent];
-        
-        bhtType=(BulletHitType) GetBulletHitTypeForSurface(iSurfaceType);
-        // if this is under water polygon
-        if( ct.ct_ulFlags&CTF_BREATHABLE_GILLS)
-        {
-          // if we hit water surface
-          if( iSurfaceType==SURFACE_WATER) 
-          {
-            vHitNormal = -vHitNormal;
-
-            bhtType=BHT_BRUSH_WATER;
-          }   
-          // if we hit stone under water
-          else
-          {
-            bhtType=BHT_BRUSH_UNDER_WATER;
-          }
-        }
-        // spawn hit effect
-        BOOL bPassable = pbpo->bpo_ulFlags & (BPOF_PASSABLE|BPOF_SHOOTTHRU);
-        if (!bPassable || iSurfaceType==SURFACE_WATER) {
-          SpawnHitTypeEffect(this, bhtType, bSound, vHitNormal, crRay.cr_vHit, vHitDirection, FLOAT3D(0.0f, 0.0f, 0.0f));
-        }
-        if(!bPassable) {
-          break;
-        }
-      // if not brush
-      } else {
-
-        // if flesh entity
-        if (crRay.cr_penHit->GetEntityInfo()!=NULL) {
-          if( ((EntityInfo*)crRay.cr_penHit->GetEntityInfo())->Eeibt == EIBT_FLESH)
-          {
-            CEntity *penOfFlesh = crRay.cr_penHit;
-            FLOAT3D vHitNormal = (GetPlacement().pl_PositionVector-m_vTarget).Normalize();
-            FLOAT3D vOldHitPos = crRay.cr_vHit;
-            FLOAT3D vDistance;
-
-            // look behind the entity (for back-stains)
-            GetWorld()->ContinueCast(crRay);
-            if( crRay.cr_penHit!=NULL && crRay.cr_pbpoBrushPolygon!=NULL && 
-                crRay.cr_penHit->GetRenderType()==RT_BRUSH)
-            {
-              vDistance = crRay.cr_vHit-vOldHitPos;
-              vHitNormal = FLOAT3D(crRay.cr_pbpoBrushPolygon->bpo_pbplPlane->bpl_plAbsolute);
-            }
-            else
-            {
-              vDistance = FLOAT3D(0.0f, 0.0f, 0.0f);
-              vHitNormal = FLOAT3D(0,0,0);
-            }
-
-            if(IsOfClass(penOfFlesh, "Gizmo") ||
-               IsOfClass(penOfFlesh, "Beast"))
-            {
-              // spawn green blood hit spill effect
-              SpawnHitTypeEffect(this, BHT_ACID, bSound, vHitNormal, crRay.cr_vHit, vHitDirection, vDistance);
-            }
-            else
-            {
-              // spawn red blood hit spill effect
-              SpawnHitTypeEffect(this, BHT_FLESH, bSound, vHitNormal, crRay.cr_vHit, vHitDirection, vDistance);
-            }
-            break;
-          }
-        }
-
-        // stop casting ray if not brush
-        break;
-      }
-    }
-
-    if( bTrail)
-    {
-      SpawnTrail();
-    }
+    m_vHitPoint = hb.hb_vHitPoint;
   };
 
   // destroy yourself
@@ -259,44 +146,11 @@ functions:
   // spawn trail of this bullet
   void SpawnTrail(void) 
   {
-    // get bullet path positions
-    const FLOAT3D &v0 = GetPlacement().pl_PositionVector;
-    const FLOAT3D &v1 = m_vHitPoint;
-    // calculate distance
-    FLOAT3D vD = v1-v0;
-    FLOAT fD = vD.Length();
-    // if too short
-    if (fD<1.0f) {
-      // no trail
-      return;
-    }
-
-    // length must be such that it doesn't get out of path
-    FLOAT fLen = Min(20.0f, fD);
-    // position is random, but it must not make trail go out of path
-    FLOAT3D vPos;
-    if (fLen<fD) {
-      vPos = Lerp(v0, v1, FRnd()*(fD-fLen)/fD);
-    } else {
-      vPos = v0;
-    }
-
-    ESpawnEffect ese;
-    UBYTE ubRndH = UBYTE( 8+FRnd()*32);
-    UBYTE ubRndS = UBYTE( 8+FRnd()*32);
-    UBYTE ubRndV = UBYTE( 224+FRnd()*32);
-    UBYTE ubRndA = UBYTE( 32+FRnd()*128);
-    ese.colMuliplier = HSVToColor(ubRndH, ubRndS, ubRndV)|ubRndA;
-    ese.betType = BET_BULLETTRAIL;
-    ese.vNormal = vD/fD;
-    ese.vStretch = FLOAT3D(0.1f, fLen, 1.0f);
-
-    // spawn effect
-    FLOAT3D vBulletIncommingDirection;
-    vBulletIncommingDirection = (m_vTarget-GetPlacement().pl_PositionVector).Normalize();
-    CPlacement3D plHit = CPlacement3D(vPos-vBulletIncommingDirection*0.1f, GetPlacement().pl_OrientationAngle);
-    CEntityPointer penHit = CreateEntity(plHit , CLASS_BASIC_EFFECT);
-    penHit->Initialize(ese);
+    // [Cecil] Spawn it through the hitscan bullet
+    CHitscanBullet hb(m_penOwner, GetPlacement(), m_fDamage);
+    hb.hb_vTarget = m_vTarget;
+    hb.hb_vHitPoint = m_vHitPoint;
+    hb.SpawnTrail();
   }
 
 procedures:
@@ -2,10 +2,14 @@
 #include "EntitiesMP/Reminder.h"
 #include "EntitiesMP/Flame.h"
 #include "EntitiesMP/Debris.h"
+#include "EntitiesMP/BloodSpray.h"
 #include "EntitiesMP/Player.h"
 #include "EntitiesMP/Bullet.h"
 #include "EntitiesMP/BackgroundViewer.h"
 #include "EntitiesMP/SoundHolder.h"
+#include "EntitiesMP/EnemySpawner.h"
+#include "EntitiesMP/Trigger.h"
+#include "EntitiesMP/Woman.h"
 #include "GameMP/PlayerSettings.h"
 #include "ModelsMP/Player/SeriousSam/Player.h"
 #include "ModelsMP/Player/SeriousSam/Body.h"
@@ -283,6 +287,15 @@ BulletHitType GetBulletHitTypeForSurface(INDEX iSurfaceType)
 // spawn effect from hit type
 void SpawnHitTypeEffect(CEntity *pen, enum BulletHitType bhtType, BOOL bSound, FLOAT3D vHitNormal, FLOAT3D vHitPoint,
   FLOAT3D vIncommingBulletDir, FLOAT3D vDistance)
+{
+  // [Cecil] Use orientation of the entity itself
+  SpawnHitTypeEffect(pen, pen->GetPlacement().pl_OrientationAngle, bhtType, bSound, vHitNormal, vHitPoint,
+                     vIncommingBulletDir, vDistance);
+}
+
+// [Cecil] 2026-10-19: Spawn effect from hit type with a specific effect orientation
+void SpawnHitTypeEffect(CEntity *pen, const ANGLE3D &aOrientation, enum BulletHitType bhtType, BOOL bSound,
+  FLOAT3D vHitNormal, FLOAT3D vHitPoint, FLOAT3D vIncommingBulletDir, FLOAT3D vDistance)
 {
   switch (bhtType)
   {
@@ -335,8 +348,8 @@ void SpawnHitTypeEffect(CEntity *pen, enum BulletHitType bhtType, BOOL bSound, F
       try
       {
         // spawn effect
-        CPlacement3D plHit = CPlacement3D(vHitPoint-vIncommingBulletDir*0.1f, pen->GetPlacement().pl_OrientationAngle);
-        CEntityPointer penHit = pen->GetWorld()->CreateEntity_t(plHit , CTFILENAME("Classes\\BasicEffect.ecl"));
+        CPlacement3D plHit = CPlacement3D(vHitPoint-vIncommingBulletDir*0.1f, aOrientation); // [Cecil]
+        CEntityPointer penHit = CreateRecycledEffect(pen, plHit); // [Cecil] 2026-10-19: Reuse finished effects
         penHit->Initialize(ese);
       }
       catch (char *strError)
@@ -376,8 +389,8 @@ void SpawnHitTypeEffect(CEntity *pen, enum BulletHitType bhtType, BOOL bSound, F
           try
           {
             // spawn effect
-            CPlacement3D plHit = CPlacement3D(vHitPoint-vIncommingBulletDir*0.1f, pen->GetPlacement().pl_OrientationAngle);
-            CEntityPointer penHit = pen->GetWorld()->CreateEntity_t(plHit , CTFILENAME("Classes\\BasicEffect.ecl"));
+            CPlacement3D plHit = CPlacement3D(vHitPoint-vIncommingBulletDir*0.1f, aOrientation); // [Cecil]
+            CEntityPointer penHit = CreateRecycledEffect(pen, plHit); // [Cecil] 2026-10-19: Reuse finished effects
             penHit->Initialize(ese);
           }
           catch (char *strError)
@@ -391,6 +404,239 @@ void SpawnHitTypeEffect(CEntity *pen, enum BulletHitType bhtType, BOOL bSound, F
   }
 }
 
+// [Cecil] 2026-10-19: Instant bullet that doesn't need its own entity
+CHitscanBullet::CHitscanBullet(CEntity *penOwner, const CPlacement3D &plSource, FLOAT fDamage) {
+  ASSERT(penOwner != NULL);
+
+  hb_penOwner = penOwner;
+  hb_plSource = plSource;
+  MakeRotationMatrixFast(hb_mRotation, plSource.pl_OrientationAngle);
+
+  hb_fDamage = fDamage;
+  hb_dmtDamage = DMT_BULLET;
+  hb_fBulletSize = 0.0f;
+  hb_vTarget = FLOAT3D(0, 0, 0);
+  hb_vTargetCopy = FLOAT3D(0, 0, 0);
+  hb_vHitPoint = FLOAT3D(0, 0, 0);
+};
+
+// Calculate target in the bullet direction
+void CHitscanBullet::CalcTarget(FLOAT fRange) {
+  AnglesToDirectionVector(hb_plSource.pl_OrientationAngle, hb_vTarget);
+  hb_vTarget *= fRange;
+  hb_vTarget += hb_plSource.pl_PositionVector;
+  hb_vTargetCopy = hb_vTarget;
+};
+
+// Calculate target towards some entity
+void CHitscanBullet::CalcTarget(CEntity *pen, FLOAT fRange) {
+  FLOAT3D vTarget;
+
+  // target body
+  EntityInfo *peiTarget = (EntityInfo *)pen->GetEntityInfo();
+  GetEntityInfoPosition(pen, peiTarget->vTargetCenter, vTarget);
+
+  hb_vTarget = (vTarget - hb_plSource.pl_PositionVector).Normalize();
+  hb_vTarget *= fRange;
+  hb_vTarget += hb_plSource.pl_PositionVector;
+  hb_vTargetCopy = hb_vTarget;
+};
+
+// Calculate jitter target (must call CalcTarget first)
+void CHitscanBullet::CalcJitterTarget(FLOAT fR) {
+  // comp graphics algorithms sphere
+  FLOAT fZ = hb_penOwner->FRnd()*2.0f - 1.0f;
+  FLOAT fA = hb_penOwner->FRnd()*360.0f;
+  FLOAT fT = Sqrt(1-(fZ*fZ));
+
+  FLOAT3D vJitter;
+  vJitter(1) = fT * CosFast(fA);
+  vJitter(2) = fT * SinFast(fA);
+  vJitter(3) = fZ;
+  vJitter = vJitter*fR*hb_penOwner->FRnd();
+
+  hb_vTarget = hb_vTargetCopy + vJitter;
+};
+
+// Calculate asymmetric jitter target (must call CalcTarget first)
+void CHitscanBullet::CalcJitterTargetFixed(FLOAT fX, FLOAT fY, FLOAT fJitter) {
+  FLOAT fRndX = hb_penOwner->FRnd()*2.0f - 1.0f;
+  FLOAT fRndY = hb_penOwner->FRnd()*2.0f - 1.0f;
+
+  const FLOATmatrix3D &m = hb_mRotation;
+  FLOAT3D vX, vY;
+  vX(1) = m(1,1); vX(2) = m(2,1); vX(3) = m(3,1);
+  vY(1) = m(1,2); vY(2) = m(2,2); vY(3) = m(3,2);
+
+  hb_vTarget = hb_vTargetCopy + (vX*(fX+fRndX*fJitter)) + (vY*(fY+fRndY*fJitter));
+};
+
+// Cast the ray and inflict damage
+void CHitscanBullet::Launch(BOOL bSound, BOOL bTrail) {
+  CWorld *pwo = hb_penOwner->GetWorld();
+  const FLOAT3D &vSource = hb_plSource.pl_PositionVector;
+  const ANGLE3D &aSource = hb_plSource.pl_OrientationAngle;
+
+  // cast a ray to find bullet target
+  CCastRay crRay(hb_penOwner, vSource, hb_vTarget);
+  crRay.cr_bHitPortals = TRUE;
+  crRay.cr_bHitTranslucentPortals = TRUE;
+  crRay.cr_ttHitModels = CCastRay::TT_COLLISIONBOX;
+  crRay.cr_bPhysical = FALSE;
+  crRay.cr_fTestR = hb_fBulletSize;
+
+  FLOAT3D vHitDirection;
+  AnglesToDirectionVector(aSource, vHitDirection);
+
+  INDEX ctCasts = 0;
+
+  while (ctCasts < 10) {
+    if (ctCasts == 0) {
+      pwo->CastRay(crRay);
+    } else {
+      pwo->ContinueCast(crRay);
+    }
+    ctCasts++;
+
+    // stop casting if nothing hit
+    if (crRay.cr_penHit == NULL) {
+      break;
+    }
+
+    // apply damage
+    const FLOAT fDamageMul = GetSeriousDamageMultiplier(hb_penOwner);
+    hb_penOwner->InflictDirectDamage(crRay.cr_penHit, hb_penOwner, hb_dmtDamage, hb_fDamage*fDamageMul,
+                                     crRay.cr_vHit, vHitDirection);
+
+    hb_vHitPoint = crRay.cr_vHit;
+
+    // if brush hitted
+    if (crRay.cr_penHit->GetRenderType() == CEntity::RT_BRUSH && crRay.cr_pbpoBrushPolygon != NULL) {
+      CBrushPolygon *pbpo = crRay.cr_pbpoBrushPolygon;
+      FLOAT3D vHitNormal = FLOAT3D(pbpo->bpo_pbplPlane->bpl_plAbsolute);
+
+      // obtain surface and content types
+      INDEX iSurfaceType = pbpo->bpo_bppProperties.bpp_ubSurfaceType;
+      INDEX iContent = pbpo->bpo_pbscSector->GetContentType();
+      CContentType &ct = pwo->wo_actContentTypes[iContent];
+
+      BulletHitType bhtType = (BulletHitType)GetBulletHitTypeForSurface(iSurfaceType);
+
+      // if this is under water polygon
+      if (ct.ct_ulFlags & CTF_BREATHABLE_GILLS) {
+        // if we hit water surface
+        if (iSurfaceType == SURFACE_WATER) {
+          vHitNormal = -vHitNormal;
+          bhtType = BHT_BRUSH_WATER;
+
+        // if we hit stone under water
+        } else {
+          bhtType = BHT_BRUSH_UNDER_WATER;
+        }
+      }
+
+      // spawn hit effect
+      BOOL bPassable = pbpo->bpo_ulFlags & (BPOF_PASSABLE|BPOF_SHOOTTHRU);
+
+      if (!bPassable || iSurfaceType == SURFACE_WATER) {
+        SpawnHitTypeEffect(hb_penOwner, aSource, bhtType, bSound, vHitNormal, crRay.cr_vHit, vHitDirection, FLOAT3D(0.0f, 0.0f, 0.0f));
+      }
+
+      if (!bPassable) {
+        break;
+      }
+
+    // if not brush
+    } else {
+      // if flesh entity
+      EntityInfo *pei = (EntityInfo *)crRay.cr_penHit->GetEntityInfo();
+
+      if (pei != NULL && pei->Eeibt == EIBT_FLESH) {
+        CEntity *penOfFlesh = crRay.cr_penHit;
+        FLOAT3D vHitNormal;
+        FLOAT3D vOldHitPos = crRay.cr_vHit;
+        FLOAT3D vDistance;
+
+        // look behind the entity (for back-stains)
+        pwo->ContinueCast(crRay);
+
+        if (crRay.cr_penHit != NULL && crRay.cr_pbpoBrushPolygon != NULL
+         && crRay.cr_penHit->GetRenderType() == CEntity::RT_BRUSH) {
+          vDistance = crRay.cr_vHit - vOldHitPos;
+          vHitNormal = FLOAT3D(crRay.cr_pbpoBrushPolygon->bpo_pbplPlane->bpl_plAbsolute);
+        } else {
+          vDistance = FLOAT3D(0.0f, 0.0f, 0.0f);
+          vHitNormal = FLOAT3D(0, 0, 0);
+        }
+
+        // spawn green or red blood hit spill effect
+        if (IsOfClass(penOfFlesh, "Gizmo") || IsOfClass(penOfFlesh, "Beast")) {
+          SpawnHitTypeEffect(hb_penOwner, aSource, BHT_ACID, bSound, vHitNormal, crRay.cr_vHit, vHitDirection, vDistance);
+        } else {
+          SpawnHitTypeEffect(hb_penOwner, aSource, BHT_FLESH, bSound, vHitNormal, crRay.cr_vHit, vHitDirection, vDistance);
+        }
+      }
+
+      // stop casting ray if not brush
+      break;
+    }
+  }
+
+  if (bTrail) {
+    SpawnTrail();
+  }
+};
+
+// Spawn trail of this bullet
+void CHitscanBullet::SpawnTrail(void) {
+  // get bullet path positions
+  const FLOAT3D &v0 = hb_plSource.pl_PositionVector;
+  const FLOAT3D &v1 = hb_vHitPoint;
+
+  // calculate distance
+  FLOAT3D vD = v1-v0;
+  FLOAT fD = vD.Length();
+
+  // no trail if too short
+  if (fD < 1.0f) {
+    return;
+  }
+
+  // length must be such that it doesn't get out of path
+  FLOAT fLen = Min(20.0f, fD);
+
+  // position is random, but it must not make trail go out of path
+  FLOAT3D vPos;
+
+  if (fLen < fD) {
+    vPos = Lerp(v0, v1, hb_penOwner->FRnd()*(fD-fLen)/fD);
+  } else {
+    vPos = v0;
+  }
+
+  ESpawnEffect ese;
+  UBYTE ubRndH = UBYTE( 8+hb_penOwner->FRnd()*32);
+  UBYTE ubRndS = UBYTE( 8+hb_penOwner->FRnd()*32);
+  UBYTE ubRndV = UBYTE( 224+hb_penOwner->FRnd()*32);
+  UBYTE ubRndA = UBYTE( 32+hb_penOwner->FRnd()*128);
+  ese.colMuliplier = HSVToColor(ubRndH, ubRndS, ubRndV)|ubRndA;
+  ese.betType = BET_BULLETTRAIL;
+  ese.vNormal = vD/fD;
+  ese.vStretch = FLOAT3D(0.1f, fLen, 1.0f);
+
+  // spawn effect
+  FLOAT3D vBulletIncommingDirection = (hb_vTarget - v0).Normalize();
+  CPlacement3D plHit = CPlacement3D(vPos-vBulletIncommingDirection*0.1f, hb_plSource.pl_OrientationAngle);
+
+  try {
+    CEntityPointer penHit = CreateRecycledEffect(hb_penOwner, plHit); // [Cecil] 2026-10-19: Reuse finished effects
+    penHit->Initialize(ese);
+
+  } catch (char *strError) {
+    FatalError(TRANS("Cannot create basic effect class: %s"), strError);
+  }
+};
+
 // spawn flame
 CEntityPointer SpawnFlame(CEntity *penOwner, CEntity *penAttach, const FLOAT3D &vSource)
 {
@@ -749,7 +995,88 @@ void SkipBlock_t(CTStream &strm)
   } while(ctLevel>0);
 }
 
-void ParseAMC_t(CModelObject *pmo, CTStream &strm, BOOL bPreview)
+// [Cecil] 2026-10-19: Player model commands that are read from AMC files
+enum EAMCCommand {
+  AMC_MODEL,
+  AMC_ANIMATION,
+  AMC_TEXTURE,
+  AMC_SPECULAR,
+  AMC_REFLECTION,
+  AMC_BUMP,
+  AMC_ATTACHMENT, // Following commands apply to the attachment until AMC_END
+  AMC_END,
+};
+
+// [Cecil] 2026-10-19: One parsed command from an AMC file
+struct SAMCCommand {
+  INDEX iCommand; // EAMCCommand
+  INDEX iValue;   // animation or attachment number
+  CTFileName fnm; // model or texture file
+  INDEX iFile;    // file with this command (for errors)
+  INDEX iLine;    // line with this command (for errors)
+};
+
+// [Cecil] 2026-10-19: AMC file that has been parsed into commands
+struct SAMCDescription {
+  CTFileName amc_fnmFile;
+  BOOL amc_bPreview;
+  CTString amc_strName;
+
+  CStaticStackArray<CTFileName> amc_aFiles; // main file and all included files
+  CStaticStackArray<SLONG> amc_aslFileTimes; // modification times of the files
+  CStaticStackArray<SAMCCommand> amc_aCommands;
+
+  // Add new command
+  void AddCommand(INDEX iCommand, INDEX iValue, const CTFileName &fnm) {
+    SAMCCommand &cmd = amc_aCommands.Push();
+    cmd.iCommand = iCommand;
+    cmd.iValue = iValue;
+    cmd.fnm = fnm;
+    cmd.iFile = amc_aFiles.Count() - 1;
+    cmd.iLine = _ctLines;
+  };
+
+  // Add file that the description depends on
+  void AddFile(const CTFileName &fnm);
+
+  // Check if none of the files have changed since parsing
+  BOOL IsUpToDate(void);
+};
+
+// [Cecil] 2026-10-19: Parsed AMC files
+static CDynamicStackArray<SAMCDescription> _aAMCCache;
+
+// [Cecil] 2026-10-19: Get modification time of some file (0 if it cannot be determined, e.g. inside archives)
+static SLONG AMCFileTime(const CTFileName &fnm) {
+  try {
+    return GetFileTimeStamp_t(fnm);
+  } catch (char *strError) {
+    (void)strError;
+  }
+  return 0;
+};
+
+void SAMCDescription::AddFile(const CTFileName &fnm) {
+  amc_aFiles.Push() = fnm;
+  amc_aslFileTimes.Push() = AMCFileTime(fnm);
+};
+
+BOOL SAMCDescription::IsUpToDate(void) {
+  // hasn't been parsed successfully
+  if (amc_aFiles.Count() == 0) {
+    return FALSE;
+  }
+
+  for (INDEX i = 0; i < amc_aFiles.Count(); i++) {
+    if (AMCFileTime(amc_aFiles[i]) != amc_aslFileTimes[i]) {
+      return FALSE;
+    }
+  }
+  return TRUE;
+};
+
+// [Cecil] Parse commands into the description instead of setting them directly
+void ParseAMC_t(SAMCDescription &amc, CTStream &strm, BOOL bPreview)
 {
   CTString strLine;
   // expect to begin with an open bracket
@@ -775,7 +1102,7 @@ void ParseAMC_t(CModelObject *pmo, CTStream &strm, BOOL bPreview)
       // if this is a preview
       if (bPreview) {
         // keep parsing it
-        ParseAMC_t(pmo, strm, bPreview);
+        ParseAMC_t(amc, strm, bPreview);
       // if this is not a preview
       } else {
         // skip that block
@@ -788,21 +1115,23 @@ void ParseAMC_t(CModelObject *pmo, CTStream &strm, BOOL bPreview)
       CTFileStream strmIncluded;
       strmIncluded.Open_t(strLine);
 
+      // [Cecil] Remember included file
+      amc.AddFile(strLine);
+
       // include it
       INDEX ctLinesOld = _ctLines;
       CTString strFileOld = _strFile;
       _ctLines = 0;
       _strFile = strLine;
-      ParseAMC_t(pmo, strmIncluded, bPreview);
+      ParseAMC_t(amc, strmIncluded, bPreview);
       strmIncluded.Close();
       _ctLines = ctLinesOld;
       _strFile = strFileOld;
 
     // if setting the model
     } else if (strLine.RemovePrefix("Model:")) {
-      // set the model
       FixupFileName_t(strLine);
-      pmo->SetData_t(strLine);
+      amc.AddCommand(AMC_MODEL, -1, strLine);
 
     // if setting an anim for the model
     } else if (strLine.RemovePrefix("Animation:")) {
@@ -812,36 +1141,27 @@ void ParseAMC_t(CModelObject *pmo, CTStream &strm, BOOL bPreview)
       if (iAnim<0) {
         ThrowF_t(TRANS("Invalid animation number"));
       }
-      // check it
-      if (iAnim>=pmo->GetAnimsCt()) {
-        ThrowF_t(TRANS("Animation %d does not exist in that model"), iAnim);
-      };
-      // set it
-      pmo->PlayAnim(iAnim, AOF_LOOPING);
+      amc.AddCommand(AMC_ANIMATION, iAnim, CTString(""));
 
     // if texture
     } else if (strLine.RemovePrefix("Texture:")) {
-      // set texture
       FixupFileName_t(strLine);
-      pmo->mo_toTexture.SetData_t(strLine);
+      amc.AddCommand(AMC_TEXTURE, -1, strLine);
 
     // if specular
     } else if (strLine.RemovePrefix("Specular:")) {
-      // set texture
       FixupFileName_t(strLine);
-      pmo->mo_toSpecular.SetData_t(strLine);
+      amc.AddCommand(AMC_SPECULAR, -1, strLine);
 
     // if reflection
     } else if (strLine.RemovePrefix("Reflection:")) {
-      // set texture
       FixupFileName_t(strLine);
-      pmo->mo_toReflection.SetData_t(strLine);
+      amc.AddCommand(AMC_REFLECTION, -1, strLine);
 
     // if specular
     } else if (strLine.RemovePrefix("Bump:")) {
-      // set texture
       FixupFileName_t(strLine);
-      pmo->mo_toBump.SetData_t(strLine);
+      amc.AddCommand(AMC_BUMP, -1, strLine);
 
     // if attachment
     } else if (strLine.RemovePrefix("Attachment:")) {
@@ -851,29 +1171,101 @@ void ParseAMC_t(CModelObject *pmo, CTStream &strm, BOOL bPreview)
       if (iAtt<0) {
         ThrowF_t(TRANS("Invalid attachment number"));
       }
-      // create attachment
-      CModelData *pmd = (CModelData*)pmo->GetData();
-      if (iAtt>=pmd->md_aampAttachedPosition.Count()) {
-        ThrowF_t(TRANS("Attachment %d does not exist in that model"), iAtt);
-      };
-      CAttachmentModelObject *pamo = pmo->AddAttachmentModel(iAtt);
-      
+      amc.AddCommand(AMC_ATTACHMENT, iAtt, CTString(""));
+
       // recursively parse it
-      ParseAMC_t(&pamo->amo_moModelObject, strm, bPreview);
+      ParseAMC_t(amc, strm, bPreview);
+      amc.AddCommand(AMC_END, -1, CTString(""));
     } else {
       ThrowF_t(TRANS("Expected texture or attachment"));
     }
   }
 }
 
-/* Set player appearance */
-BOOL SetPlayerAppearance_internal(CModelObject *pmo, const CTFileName &fnmAMC, CTString &strName, BOOL bPreview)
+// [Cecil] 2026-10-19: Apply parsed commands to the model object (until the end of the current attachment)
+void ApplyAMC_t(CModelObject *pmo, SAMCDescription &amc, INDEX &iCommand)
 {
-  // try to
+  while (iCommand < amc.amc_aCommands.Count()) {
+    const SAMCCommand &cmd = amc.amc_aCommands[iCommand++];
+
+    // for error reporting
+    _strFile = amc.amc_aFiles[cmd.iFile];
+    _ctLines = cmd.iLine;
+
+    switch (cmd.iCommand) {
+      // set the model
+      case AMC_MODEL: pmo->SetData_t(cmd.fnm); break;
+
+      // set the animation
+      case AMC_ANIMATION: {
+        if (cmd.iValue >= pmo->GetAnimsCt()) {
+          ThrowF_t(TRANS("Animation %d does not exist in that model"), cmd.iValue);
+        }
+        pmo->PlayAnim(cmd.iValue, AOF_LOOPING);
+      } break;
+
+      // set textures
+      case AMC_TEXTURE:    pmo->mo_toTexture.SetData_t(cmd.fnm); break;
+      case AMC_SPECULAR:   pmo->mo_toSpecular.SetData_t(cmd.fnm); break;
+      case AMC_REFLECTION: pmo->mo_toReflection.SetData_t(cmd.fnm); break;
+      case AMC_BUMP:       pmo->mo_toBump.SetData_t(cmd.fnm); break;
+
+      // create attachment
+      case AMC_ATTACHMENT: {
+        CModelData *pmd = (CModelData *)pmo->GetData();
+        if (pmd == NULL || cmd.iValue >= pmd->md_aampAttachedPosition.Count()) {
+          ThrowF_t(TRANS("Attachment %d does not exist in that model"), cmd.iValue);
+        }
+        CAttachmentModelObject *pamo = pmo->AddAttachmentModel(cmd.iValue);
+
+        // recursively apply it
+        ApplyAMC_t(&pamo->amo_moModelObject, amc, iCommand);
+      } break;
+
+      // attachment end
+      case AMC_END: return;
+    }
+  }
+}
+
+// [Cecil] 2026-10-19: Parse the AMC file or get it from the cache
+SAMCDescription &GetAMC_t(const CTFileName &fnmAMC, BOOL bPreview)
+{
+  SAMCDescription *pamc = NULL;
+
+  // find cached description
+  for (INDEX iCached = 0; iCached < _aAMCCache.Count(); iCached++) {
+    SAMCDescription &amcCached = _aAMCCache[iCached];
+
+    if (amcCached.amc_fnmFile == fnmAMC && amcCached.amc_bPreview == bPreview) {
+      // reuse it if nothing has changed
+      if (amcCached.IsUpToDate()) {
+        return amcCached;
+      }
+
+      // otherwise parse it again
+      pamc = &amcCached;
+      break;
+    }
+  }
+
+  if (pamc == NULL) {
+    pamc = &_aAMCCache.Push();
+    pamc->amc_fnmFile = fnmAMC;
+    pamc->amc_bPreview = bPreview;
+  }
+
+  SAMCDescription &amc = *pamc;
+  amc.amc_strName = "";
+  amc.amc_aFiles.PopAll();
+  amc.amc_aslFileTimes.PopAll();
+  amc.amc_aCommands.PopAll();
+
   try {
     // open the config file
     CTFileStream strm;
     strm.Open_t(fnmAMC);
+    amc.AddFile(fnmAMC);
 
     _ctLines = 0;
     _strFile = fnmAMC;
@@ -883,11 +1275,35 @@ BOOL SetPlayerAppearance_internal(CModelObject *pmo, const CTFileName &fnmAMC, C
     if (!strLine.RemovePrefix("Name: ")) {
       ThrowF_t(TRANS("Expected name"));
     }
-    strName = strLine;
-    strName.TrimSpacesLeft();
+    amc.amc_strName = strLine;
+    amc.amc_strName.TrimSpacesLeft();
+
+    // parse the file recursively
+    ParseAMC_t(amc, strm, bPreview);
+
+  // don't keep broken descriptions
+  } catch (char *) {
+    amc.amc_aFiles.PopAll();
+    amc.amc_aslFileTimes.PopAll();
+    amc.amc_aCommands.PopAll();
+    throw;
+  }
 
-    // parse the file recursively starting at root model object and add everything
-    ParseAMC_t(pmo, strm, bPreview);
+  return amc;
+}
+
+/* Set player appearance */
+BOOL SetPlayerAppearance_internal(CModelObject *pmo, const CTFileName &fnmAMC, CTString &strName, BOOL bPreview)
+{
+  // try to
+  try {
+    // [Cecil] Get parsed config file
+    SAMCDescription &amc = GetAMC_t(fnmAMC, bPreview);
+    strName = amc.amc_strName;
+
+    // [Cecil] Add everything starting at root model object
+    INDEX iCommand = 0;
+    ApplyAMC_t(pmo, amc, iCommand);
     return TRUE;
 
   // if anything failed
@@ -1017,8 +1433,8 @@ CEntityPointer Debris_Spawn(
     vStretch=penSpawner->GetModelObject()->mo_Stretch;
   }
   penSpawner->GetEntityPointRatio(vPosRatio, vPos);
-  CEntityPointer penDebris = penSpawner->GetWorld()->CreateEntity_t(
-    CPlacement3D(vPos, ANGLE3D(0,0,0)), CTFILENAME("Classes\\Debris.ecl"));
+  // [Cecil] 2026-10-19: Reuse finished debris
+  CEntityPointer penDebris = CreateRecycledDebris(penSpawner, CPlacement3D(vPos, ANGLE3D(0,0,0)));
   // prepare parameters
   ESpawnDebris eSpawn;
   eSpawn.bImmaterialASAP=FALSE;
@@ -1086,8 +1502,8 @@ CEntityPointer Debris_Spawn_Independent(
   ANGLE3D aRotation)
 {
   // create debris at same world as spawner
-  CEntityPointer penDebris = penSpawner->GetWorld()->CreateEntity_t(
-    plAbsolutePlacement, CTFILENAME("Classes\\Debris.ecl"));
+  // [Cecil] 2026-10-19: Reuse finished debris
+  CEntityPointer penDebris = CreateRecycledDebris(penSpawner, plAbsolutePlacement);
   // prepare parameters
   ESpawnDebris eSpawn;
   eSpawn.bImmaterialASAP=FALSE;
@@ -1137,8 +1553,8 @@ CEntityPointer Debris_Spawn_Template(
     return NULL;
   }
   // create debris at same world as spawner
-  CEntityPointer penDebris = penmhDestroyed->GetWorld()->CreateEntity_t(
-    plAbsolutePlacement, CTFILENAME("Classes\\Debris.ecl"));
+  // [Cecil] 2026-10-19: Reuse finished debris
+  CEntityPointer penDebris = CreateRecycledDebris(penmhDestroyed, plAbsolutePlacement);
   // prepare parameters
   ESpawnDebris eSpawn;
   eSpawn.bImmaterialASAP=bDebrisImmaterialASAP;
@@ -1413,3 +1829,367 @@ class CWorldSettingsController *GetWSC(CEntity *pen)
   return pwsc;
 }
 
+// [Cecil] 2026-10-19: Remembered main music holder
+static CEntity *_penMainMusicHolder = NULL;
+static BOOL _bMainMusicHolderFound = FALSE;
+
+// Get main music holder of the current world without searching for it every time
+CEntity *GetMainMusicHolder(void) {
+  if (_bMainMusicHolderFound) {
+    return _penMainMusicHolder;
+  }
+
+  CEntity *pen = _pNetwork->GetEntityWithName("MusicHolder", 0);
+
+  // only remember actual music holders because only they reset it
+  if (pen == NULL || IsOfClass(pen, "MusicHolder")) {
+    _penMainMusicHolder = pen;
+    _bMainMusicHolderFound = TRUE;
+  }
+
+  return pen;
+};
+
+// Forget the main music holder after music holders have changed
+void ResetMainMusicHolder(void) {
+  _penMainMusicHolder = NULL;
+  _bMainMusicHolderFound = FALSE;
+};
+
+// [Cecil] 2026-10-19: Totals of one world
+struct SWorldCounts {
+  CWorld *pwo;
+  INDEX ctEnemies;
+  INDEX ctSecrets;
+};
+
+static CStaticStackArray<SWorldCounts> _awcWorlds;
+
+// Find totals of some world
+static SWorldCounts *FindWorldCounts(CWorld *pwo, BOOL bAdd) {
+  for (INDEX i = 0; i < _awcWorlds.Count(); i++) {
+    if (_awcWorlds[i].pwo == pwo) {
+      return &_awcWorlds[i];
+    }
+  }
+
+  if (!bAdd) return NULL;
+
+  SWorldCounts &wc = _awcWorlds.Push();
+  wc.pwo = pwo;
+  wc.ctEnemies = 0;
+  wc.ctSecrets = 0;
+  return &wc;
+};
+
+// Change what the entity adds to the totals
+void CWorldCount::Set(CWorld *pwo, INDEX ctEnemies, INDEX ctSecrets) {
+  // remove from the previous world
+  if (wc_pwo != NULL) {
+    SWorldCounts *pwc = FindWorldCounts(wc_pwo, FALSE);
+    ASSERT(pwc != NULL);
+
+    if (pwc != NULL) {
+      pwc->ctEnemies -= wc_ctEnemies;
+      pwc->ctSecrets -= wc_ctSecrets;
+    }
+  }
+
+  wc_pwo = pwo;
+  wc_ctEnemies = ctEnemies;
+  wc_ctSecrets = ctSecrets;
+
+  // add to the new world
+  if (wc_pwo != NULL) {
+    SWorldCounts *pwc = FindWorldCounts(wc_pwo, TRUE);
+    pwc->ctEnemies += wc_ctEnemies;
+    pwc->ctSecrets += wc_ctSecrets;
+  }
+};
+
+// Counts of entities that have to count themselves again
+static CStaticStackArray<CWorldCount *> _apwcPending;
+
+// Let the entity count itself again when the totals are needed (or stop waiting for it)
+void CWorldCount::SetPending(CEntity *pen) {
+  // stop waiting
+  if (wc_penPending != NULL) {
+    for (INDEX i = 0; i < _apwcPending.Count(); i++) {
+      if (_apwcPending[i] == this) {
+        _apwcPending[i] = _apwcPending[_apwcPending.Count() - 1];
+        _apwcPending.Pop();
+        break;
+      }
+    }
+  }
+
+  wc_penPending = pen;
+
+  if (wc_penPending != NULL) {
+    _apwcPending.Push() = this;
+  }
+};
+
+// Count entities that have been waiting for it
+static void UpdatePendingCounts(void) {
+  while (_apwcPending.Count() > 0) {
+    CWorldCount *pwc = _apwcPending.Pop();
+    CEntity *pen = pwc->wc_penPending;
+    pwc->wc_penPending = NULL;
+
+    // spawners count enemies from their templates, which might not have been read with them
+    if (IsDerivedFromClass(pen, "Enemy Spawner")) {
+      ((CEnemySpawner *)pen)->UpdateWorldCount();
+    }
+  }
+};
+
+// Get totals of enemies and secrets in the world without scanning it
+void GetWorldCounts(CWorld *pwo, INDEX &ctEnemies, INDEX &ctSecrets) {
+  UpdatePendingCounts();
+
+  SWorldCounts *pwc = FindWorldCounts(pwo, FALSE);
+
+  ctEnemies = (pwc != NULL ? pwc->ctEnemies : 0);
+  ctSecrets = (pwc != NULL ? pwc->ctSecrets : 0);
+};
+
+// Count enemies and secrets by going through all entities in the world
+static void ScanWorldCounts(CWorld *pwo, INDEX &ctEnemies, INDEX &ctSecrets) {
+  ctEnemies = 0;
+  ctSecrets = 0;
+
+  // for each entity in the world
+  {FOREACHINDYNAMICCONTAINER(pwo->wo_cenEntities, CEntity, iten) {
+    CEntity *pen = iten;
+    // if enemybase
+    if (IsDerivedFromClass(pen, "Enemy Base")) {
+      CEnemyBase *penEnemy = (CEnemyBase *)pen;
+      // if not template
+      if (!penEnemy->m_bTemplate) {
+        // count one
+        ctEnemies++;
+        // if this is a woman kamikaze carrier, add another one to count
+        if (IsOfClass(pen, "Woman")) {
+          if (((CWoman *)&*pen)->m_bKamikazeCarrier) { ctEnemies++; }
+        }
+      }
+    // if spawner
+    } else if (IsDerivedFromClass(pen, "Enemy Spawner")) {
+      CEnemySpawner *penSpawner = (CEnemySpawner *)pen;
+      // if not teleporting
+      if (penSpawner->m_estType!=EST_TELEPORTER) {
+        // add total count
+        ctEnemies+=penSpawner->m_ctTotal;
+        // if this spawner points to a woman kamikaze carrier template, increase count once more
+        if (penSpawner->m_penTarget) {
+          if (IsOfClass(penSpawner->m_penTarget, "Woman")) {
+            if (((CWoman *)&*penSpawner->m_penTarget)->m_bKamikazeCarrier) { ctEnemies+=penSpawner->m_ctTotal; }
+          }
+        }
+      }
+    // if trigger
+    } else if (IsDerivedFromClass(pen, "Trigger")) {
+      CTrigger *penTrigger = (CTrigger *)pen;
+      // if has score
+      if (penTrigger->m_fScore>0) {
+        // it counts as a secret
+        ctSecrets++;
+      }
+    }
+  }}
+};
+
+// Compare maintained totals in the current world against a full scan
+void CECIL_CheckWorldCounts(void) {
+  CWorld *pwo = &_pNetwork->ga_World;
+
+  INDEX ctEnemies, ctSecrets;
+  GetWorldCounts(pwo, ctEnemies, ctSecrets);
+
+  INDEX ctScanEnemies, ctScanSecrets;
+  ScanWorldCounts(pwo, ctScanEnemies, ctScanSecrets);
+
+  CPrintF("Enemies: %d maintained, %d scanned\n", ctEnemies, ctScanEnemies);
+  CPrintF("Secrets: %d maintained, %d scanned\n", ctSecrets, ctScanSecrets);
+
+  if (ctEnemies != ctScanEnemies || ctSecrets != ctScanSecrets) {
+    CPrintF("^cff0000Maintained totals don't match!\n");
+  } else {
+    CPrintF("^c00ff00Maintained totals match.\n");
+  }
+};
+
+// [Cecil] 2026-10-19: Statistics of reusing entities
+extern INDEX MOD_ctRecycleHits;
+extern INDEX MOD_ctRecycleMisses;
+extern INDEX MOD_ctRecycleEvictions;
+
+// [Cecil] 2026-10-19: Finished entities of one kind in one world
+struct SRecyclePool {
+  CWorld *rp_pwo;
+  INDEX rp_iKind;
+  CListHead rp_lhFinished; // from the oldest to the newest
+  INDEX rp_ctFinished;
+  INDEX rp_iLastOrder;
+};
+
+// Pools are never freed because entities keep pointers to them
+static CDynamicContainer<SRecyclePool> _cRecyclePools;
+
+static SRecyclePool &GetRecyclePool(CWorld *pwo, INDEX iKind) {
+  {FOREACHINDYNAMICCONTAINER(_cRecyclePools, SRecyclePool, itrp) {
+    if (itrp->rp_pwo == pwo && itrp->rp_iKind == iKind) {
+      return *itrp;
+    }
+  }}
+
+  SRecyclePool *prp = new SRecyclePool;
+  prp->rp_pwo = pwo;
+  prp->rp_iKind = iKind;
+  prp->rp_ctFinished = 0;
+  prp->rp_iLastOrder = 0;
+  _cRecyclePools.Add(prp);
+  return *prp;
+};
+
+// Bind to the owner entity
+void CRecycleLink::Init(CEntity *pen, INDEX iKind, INDEX *piOrder) {
+  rl_pen = pen;
+  rl_iKind = iKind;
+  rl_piOrder = piOrder;
+};
+
+// Put finished entity at the end of the pool, destroying the oldest one if it's full
+void CRecycleLink::Park(void) {
+  ASSERT(!rl_lnInPool.IsLinked());
+
+  // destroy attached entities (like flames), as if the entity itself was destroyed
+  {FORDELETELIST(CEntity, en_lnInParent, rl_pen->en_lhChildren, itenChild) {
+    CEntity *penChild = itenChild;
+    penChild->SetParent(NULL);
+    penChild->Destroy();
+  }}
+
+  SRecyclePool &rp = GetRecyclePool(rl_pen->GetWorld(), rl_iKind);
+
+  if (rp.rp_ctFinished >= RECYCLE_LIMIT) {
+    CRecycleLink &rlOldest = *LIST_HEAD(rp.rp_lhFinished, CRecycleLink, rl_lnInPool);
+    CEntity *penOldest = rlOldest.rl_pen;
+
+    rlOldest.Unlink();
+    penOldest->Destroy();
+    MOD_ctRecycleEvictions++;
+  }
+
+  *rl_piOrder = ++rp.rp_iLastOrder;
+  rp.rp_lhFinished.AddTail(rl_lnInPool);
+  rp.rp_ctFinished++;
+  rl_prp = &rp;
+};
+
+// Put entity back into the pool after reading it
+void CRecycleLink::Relink(void) {
+  ASSERT(!rl_lnInPool.IsLinked() && *rl_piOrder > 0);
+  SRecyclePool &rp = GetRecyclePool(rl_pen->GetWorld(), rl_iKind);
+
+  // keep the same order that it had before saving, regardless of reading order
+  LISTITER(CRecycleLink, rl_lnInPool) itrl(rp.rp_lhFinished);
+
+  while (!itrl.IsPastEnd() && *itrl->rl_piOrder < *rl_piOrder) {
+    itrl.MoveToNext();
+  }
+
+  if (itrl.IsPastEnd()) {
+    rp.rp_lhFinished.AddTail(rl_lnInPool);
+  } else {
+    itrl.InsertBeforeCurrent(rl_lnInPool);
+  }
+
+  rp.rp_ctFinished++;
+  rp.rp_iLastOrder = Max(rp.rp_iLastOrder, *rl_piOrder);
+  rl_prp = &rp;
+};
+
+// Remove from the pool
+void CRecycleLink::Unlink(void) {
+  if (!rl_lnInPool.IsLinked()) return;
+
+  rl_lnInPool.Remove();
+  rl_prp->rp_ctFinished--;
+  rl_prp = NULL;
+  *rl_piOrder = 0;
+};
+
+// Take the oldest finished entity of some kind out of the pool and prepare it
+CEntity *TakeRecycledEntity(CWorld *pwo, INDEX iKind, const CPlacement3D &pl) {
+  SRecyclePool &rp = GetRecyclePool(pwo, iKind);
+
+  if (rp.rp_lhFinished.IsEmpty()) {
+    MOD_ctRecycleMisses++;
+    return NULL;
+  }
+
+  CRecycleLink &rl = *LIST_HEAD(rp.rp_lhFinished, CRecycleLink, rl_lnInPool);
+  CEntity *pen = rl.rl_pen;
+  rl.Unlink();
+
+  // reset it to the state of a newly created entity
+  pen->End();
+  pen->SetDefaultProperties();
+  pen->SetPlacement(pl);
+
+  MOD_ctRecycleHits++;
+  return pen;
+};
+
+// Create new basic effect or reuse a finished one
+CEntity *CreateRecycledEffect(CEntity *penCreator, const CPlacement3D &pl) {
+  // predicted effects are never reused
+  if (penCreator->IsPredictor()) {
+    return penCreator->GetWorld()->CreateEntity_t(pl, CTFILENAME("Classes\\BasicEffect.ecl"));
+  }
+
+  CBasicEffect *pen = (CBasicEffect *)TakeRecycledEntity(penCreator->GetWorld(), ERK_BASICEFFECT, pl);
+
+  if (pen == NULL) {
+    pen = (CBasicEffect *)penCreator->GetWorld()->CreateEntity_t(pl, CTFILENAME("Classes\\BasicEffect.ecl"));
+  }
+
+  pen->m_bRecyclable = TRUE;
+  return pen;
+};
+
+// Create new debris or reuse a finished one
+CEntity *CreateRecycledDebris(CEntity *penCreator, const CPlacement3D &pl) {
+  // predicted debris is never reused
+  if (penCreator->IsPredictor()) {
+    return penCreator->GetWorld()->CreateEntity_t(pl, CTFILENAME("Classes\\Debris.ecl"));
+  }
+
+  CDebris *pen = (CDebris *)TakeRecycledEntity(penCreator->GetWorld(), ERK_DEBRIS, pl);
+
+  if (pen == NULL) {
+    pen = (CDebris *)penCreator->GetWorld()->CreateEntity_t(pl, CTFILENAME("Classes\\Debris.ecl"));
+  }
+
+  pen->m_bRecyclable = TRUE;
+  return pen;
+};
+
+// Create new blood spray or reuse a finished one
+CEntity *CreateRecycledSpray(CEntity *penCreator, const CPlacement3D &pl) {
+  // predicted sprays are never reused
+  if (penCreator->IsPredictor()) {
+    return penCreator->GetWorld()->CreateEntity_t(pl, CTFILENAME("Classes\\BloodSpray.ecl"));
+  }
+
+  CBloodSpray *pen = (CBloodSpray *)TakeRecycledEntity(penCreator->GetWorld(), ERK_BLOODSPRAY, pl);
+
+  if (pen == NULL) {
+    pen = (CBloodSpray *)penCreator->GetWorld()->CreateEntity_t(pl, CTFILENAME("Classes\\BloodSpray.ecl"));
+  }
+
+  pen->m_bRecyclable = TRUE;
+  return pen;
+};
@@ -300,4 +300,138 @@ EffectParticlesType GetParticleEffectTypeForSurface(INDEX iSurfaceType);
 void SpawnHitTypeEffect(CEntity *pen, enum BulletHitType bhtType, BOOL bSound, FLOAT3D vHitNormal, FLOAT3D vHitPoint,
   FLOAT3D vIncommingBulletDir, FLOAT3D vDistance);
 
+// [Cecil] 2026-10-19: Spawn effect from hit type with a specific effect orientation
+void SpawnHitTypeEffect(CEntity *pen, const ANGLE3D &aOrientation, enum BulletHitType bhtType, BOOL bSound,
+  FLOAT3D vHitNormal, FLOAT3D vHitPoint, FLOAT3D vIncommingBulletDir, FLOAT3D vDistance);
+
+// [Cecil] 2026-10-19: Instant bullet that doesn't need its own entity
+class DECL_DLL CHitscanBullet {
+  public:
+    CEntity *hb_penOwner;           // entity which fired it
+    CPlacement3D hb_plSource;       // bullet start position and direction
+    FLOATmatrix3D hb_mRotation;     // rotation matrix of the direction
+    FLOAT hb_fDamage;               // damage
+    enum DamageType hb_dmtDamage;   // damage type
+    FLOAT hb_fBulletSize;           // bullet radius, for hitting models only
+    FLOAT3D hb_vTarget;             // bullet target point in space
+    FLOAT3D hb_vTargetCopy;         // copy of the target point for jitter
+    FLOAT3D hb_vHitPoint;           // last hit point
+
+  public:
+    // Constructor
+    CHitscanBullet(CEntity *penOwner, const CPlacement3D &plSource, FLOAT fDamage);
+
+    // Calculate target in the bullet direction
+    void CalcTarget(FLOAT fRange);
+
+    // Calculate target towards some entity
+    void CalcTarget(CEntity *pen, FLOAT fRange);
+
+    // Calculate jitter target (must call CalcTarget first)
+    void CalcJitterTarget(FLOAT fR);
+
+    // Calculate asymmetric jitter target (must call CalcTarget first)
+    void CalcJitterTargetFixed(FLOAT fX, FLOAT fY, FLOAT fJitter);
+
+    // Cast the ray and inflict damage
+    void Launch(BOOL bSound, BOOL bTrail);
+
+    // Spawn trail of this bullet
+    void SpawnTrail(void);
+};
+
+// [Cecil] 2026-10-19: Get main music holder of the current world without searching for it every time
+DECL_DLL CEntity *GetMainMusicHolder(void);
+
+// [Cecil] 2026-10-19: Forget the main music holder after music holders have changed
+DECL_DLL void ResetMainMusicHolder(void);
+
+// [Cecil] 2026-10-19: Enemies and secrets that one entity adds to the totals of its world
+class DECL_DLL CWorldCount {
+  public:
+    CWorld *wc_pwo;
+    INDEX wc_ctEnemies;
+    INDEX wc_ctSecrets;
+    CEntity *wc_penPending; // entity that has to count itself again before the totals are read
+
+  public:
+    // Constructor
+    CWorldCount(void) : wc_pwo(NULL), wc_ctEnemies(0), wc_ctSecrets(0), wc_penPending(NULL) {};
+
+    // Destructor
+    ~CWorldCount(void) {
+      Set(NULL, 0, 0);
+      SetPending(NULL);
+    };
+
+    // Change what the entity adds to the totals
+    void Set(CWorld *pwo, INDEX ctEnemies, INDEX ctSecrets);
+
+    // Let the entity count itself again when the totals are needed (or stop waiting for it)
+    void SetPending(CEntity *pen);
+};
+
+// [Cecil] 2026-10-19: Get totals of enemies and secrets in the world without scanning it
+DECL_DLL void GetWorldCounts(CWorld *pwo, INDEX &ctEnemies, INDEX &ctSecrets);
+
+// [Cecil] 2026-10-19: Compare maintained totals in the current world against a full scan
+DECL_DLL void CECIL_CheckWorldCounts(void);
+
+// [Cecil] 2026-10-19: Kinds of short-lived entities that are reused after finishing
+enum ERecycledKind {
+  ERK_BASICEFFECT = 0,
+  ERK_DEBRIS,
+  ERK_BLOODSPRAY,
+
+  ERK_LAST,
+};
+
+// [Cecil] 2026-10-19: Maximum amount of finished entities of one kind per world
+// It's a constant because every machine in the game has to keep the same entities
+#define RECYCLE_LIMIT 256
+
+// [Cecil] 2026-10-19: Link of a finished short-lived entity in the pool of its kind
+class DECL_DLL CRecycleLink {
+  public:
+    CEntity *rl_pen;  // entity that owns this link
+    INDEX *rl_piOrder; // entity property with the order of finishing (0 if it's active)
+    INDEX rl_iKind;
+    struct SRecyclePool *rl_prp; // pool that it's in
+    CListNode rl_lnInPool;
+
+  public:
+    // Constructor
+    CRecycleLink(void) : rl_pen(NULL), rl_piOrder(NULL), rl_iKind(ERK_BASICEFFECT), rl_prp(NULL) {};
+
+    // Destructor
+    ~CRecycleLink(void) {
+      Unlink();
+    };
+
+    // Bind to the owner entity
+    void Init(CEntity *pen, INDEX iKind, INDEX *piOrder);
+
+    // Put finished entity at the end of the pool after destroying its children, destroying the oldest one if it's full
+    void Park(void);
+
+    // Put entity back into the pool after reading it
+    void Relink(void);
+
+    // Remove from the pool
+    void Unlink(void);
+};
+
+// [Cecil] 2026-10-19: Take the oldest finished entity of some kind out of the pool and prepare it
+// for initialization at a new place, as if it was just created (returns NULL if there are none)
+DECL_DLL CEntity *TakeRecycledEntity(CWorld *pwo, INDEX iKind, const CPlacement3D &pl);
+
+// [Cecil] 2026-10-19: Create new basic effect or reuse a finished one
+DECL_DLL CEntity *CreateRecycledEffect(CEntity *penCreator, const CPlacement3D &pl);
+
+// [Cecil] 2026-10-19: Create new debris or reuse a finished one
+DECL_DLL CEntity *CreateRecycledDebris(CEntity *penCreator, const CPlacement3D &pl);
+
+// [Cecil] 2026-10-19: Create new blood spray or reuse a finished one
+DECL_DLL CEntity *CreateRecycledSpray(CEntity *penCreator, const CPlacement3D &pl);
+
 #define FRndIn(a, b) (a + FRnd()*(b - a))
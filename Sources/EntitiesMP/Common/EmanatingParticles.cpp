@@ -1,5 +1,13 @@
 #include "StdH.h"
 
+// [Cecil] 2026-10-19: SSE for particle integration
+#if defined(_M_IX86) || defined(_M_X64) || defined(__SSE__)
+  #define CECIL_EMITER_SSE 1
+  #include <xmmintrin.h>
+#else
+  #define CECIL_EMITER_SSE 0
+#endif
+
 #define ID_EMITER_VER "EMT0"
 
 CEmittedParticle::CEmittedParticle(void)
@@ -33,7 +41,71 @@ CEmiter::CEmiter(void)
   em_vG=FLOAT3D(0,1,0);
   em_colGlobal=C_WHITE|CT_OPAQUE;
   em_iGlobal=0;
-  em_aepParticles.Clear();
+  ClearParticles();
+}
+
+// [Cecil] Remove all particles
+void CEmiter::ClearParticles(void)
+{
+  em_avLastPos.Clear();
+  em_avPos.Clear();
+  em_afLastRot.Clear();
+  em_afRot.Clear();
+  em_afRotSpeed.Clear();
+  em_avSpeed.Clear();
+  em_acolLastColor.Clear();
+  em_acolColor.Clear();
+  em_atmEmitted.Clear();
+  em_atmLife.Clear();
+  em_afStretch.Clear();
+}
+
+// [Cecil] Remove particles after the first ones
+void CEmiter::PopParticles(INDEX ctKeep)
+{
+  if (ctKeep <= 0) {
+    em_avLastPos.PopAll();
+    em_avPos.PopAll();
+    em_afLastRot.PopAll();
+    em_afRot.PopAll();
+    em_afRotSpeed.PopAll();
+    em_avSpeed.PopAll();
+    em_acolLastColor.PopAll();
+    em_acolColor.PopAll();
+    em_atmEmitted.PopAll();
+    em_atmLife.PopAll();
+    em_afStretch.PopAll();
+    return;
+  }
+
+  const INDEX iLast = ctKeep-1;
+  em_avLastPos.PopUntil(iLast);
+  em_avPos.PopUntil(iLast);
+  em_afLastRot.PopUntil(iLast);
+  em_afRot.PopUntil(iLast);
+  em_afRotSpeed.PopUntil(iLast);
+  em_avSpeed.PopUntil(iLast);
+  em_acolLastColor.PopUntil(iLast);
+  em_acolColor.PopUntil(iLast);
+  em_atmEmitted.PopUntil(iLast);
+  em_atmLife.PopUntil(iLast);
+  em_afStretch.PopUntil(iLast);
+}
+
+// [Cecil] Get particle in one structure
+void CEmiter::GetParticle(INDEX i, CEmittedParticle &ep) const
+{
+  ep.ep_vLastPos=em_avLastPos[i];
+  ep.ep_vPos=em_avPos[i];
+  ep.ep_fLastRot=em_afLastRot[i];
+  ep.ep_fRot=em_afRot[i];
+  ep.ep_fRotSpeed=em_afRotSpeed[i];
+  ep.ep_vSpeed=em_avSpeed[i];
+  ep.ep_colLastColor=em_acolLastColor[i];
+  ep.ep_colColor=em_acolColor[i];
+  ep.ep_tmEmitted=em_atmEmitted[i];
+  ep.ep_tmLife=em_atmLife[i];
+  ep.ep_fStretch=em_afStretch[i];
 }
 
 void CEmiter::Initialize(CEntity *pen)
@@ -57,64 +129,161 @@ FLOAT3D CEmiter::GetGravity(CEntity *pen)
 void CEmiter::AddParticle(FLOAT3D vPos, FLOAT3D vSpeed, FLOAT fRot, FLOAT fRotSpeed, 
                           FLOAT tmBirth, FLOAT tmLife, FLOAT fStretch, COLOR colColor)
 {
-  CEmittedParticle &em=em_aepParticles.Push();
-  em.ep_fLastRot=fRot;
-  em.ep_fRot=fRot;
-  em.ep_fRotSpeed=fRotSpeed;
-  em.ep_vLastPos=vPos;
-  em.ep_vPos=vPos;
-  em.ep_vSpeed=vSpeed;
-  em.ep_colLastColor=colColor;
-  em.ep_colColor=colColor;
-  em.ep_tmEmitted=tmBirth;
-  em.ep_tmLife=tmLife;
-  em.ep_fStretch=fStretch;
+  em_afLastRot.Push()=fRot;
+  em_afRot.Push()=fRot;
+  em_afRotSpeed.Push()=fRotSpeed;
+  em_avLastPos.Push()=vPos;
+  em_avPos.Push()=vPos;
+  em_avSpeed.Push()=vSpeed;
+  em_acolLastColor.Push()=colColor;
+  em_acolColor.Push()=colColor;
+  em_atmEmitted.Push()=tmBirth;
+  em_atmLife.Push()=tmLife;
+  em_afStretch.Push()=fStretch;
 }
 
 void CEmiter::AnimateParticles(void)
 {
-  FLOAT tmNow=_pTimer->CurrentTick();
-  INDEX ctCount=em_aepParticles.Count();
-  INDEX iCurrent=0;
-  while( iCurrent<ctCount)
+  const FLOAT tmNow=_pTimer->CurrentTick();
+  const FLOAT tmQuantum=_pTimer->TickQuantum;
+  const INDEX ctCount=Count();
+
+  if (ctCount==0) {
+    return;
+  }
+
+  // [Cecil] Remove particles that shouldn't live any more in one pass, keeping the order
+  INDEX ctAlive=0;
+  INDEX i;
+
+  for (i=0; i<ctCount; i++)
   {
-    CEmittedParticle &ep=em_aepParticles[iCurrent];
-    // not yet alive
-    if(ep.ep_tmEmitted<0)
-    {
-      iCurrent++;
-    }
-    // if shouldn't live any more
-    else if( tmNow>ep.ep_tmEmitted+ep.ep_tmLife)
-    {
-      CEmittedParticle &emLast=em_aepParticles[ctCount-1];
-      ep=emLast;
-      ctCount--;
+    const FLOAT tmEmitted=em_atmEmitted[i];
+
+    // dead
+    if (tmEmitted>=0 && tmNow>tmEmitted+em_atmLife[i]) {
+      continue;
     }
-    // it is alive, animate it
-    else
-    {
-      // animate position
-      ep.ep_vLastPos=ep.ep_vPos;
-      ep.ep_vSpeed=ep.ep_vSpeed+em_vG*_pTimer->TickQuantum;
-      ep.ep_vPos=ep.ep_vPos+ep.ep_vSpeed*_pTimer->TickQuantum;
-      // animate rotation
-      ep.ep_fLastRot=ep.ep_fRot;
-      ep.ep_fRot+=ep.ep_fRotSpeed*_pTimer->TickQuantum;
-      // animate color
-      FLOAT fRatio=CalculateRatio(tmNow, ep.ep_tmEmitted, ep.ep_tmEmitted+ep.ep_tmLife, 1, 0);
-      ep.ep_colLastColor=ep.ep_colColor;
-      iCurrent++;
+
+    if (ctAlive!=i) {
+      em_avLastPos[ctAlive]=em_avLastPos[i];
+      em_avPos[ctAlive]=em_avPos[i];
+      em_afLastRot[ctAlive]=em_afLastRot[i];
+      em_afRot[ctAlive]=em_afRot[i];
+      em_afRotSpeed[ctAlive]=em_afRotSpeed[i];
+      em_avSpeed[ctAlive]=em_avSpeed[i];
+      em_acolLastColor[ctAlive]=em_acolLastColor[i];
+      em_acolColor[ctAlive]=em_acolColor[i];
+      em_atmEmitted[ctAlive]=tmEmitted;
+      em_atmLife[ctAlive]=em_atmLife[i];
+      em_afStretch[ctAlive]=em_afStretch[i];
     }
+    ctAlive++;
+  }
+
+  if (ctAlive!=ctCount) {
+    PopParticles(ctAlive);
   }
-  if( em_aepParticles.Count()==0)
+
+  if (ctAlive==0) {
+    return;
+  }
+
+  // [Cecil] Remember last state of all particles at once
+  // (particles that aren't alive yet never change, so their last state always matches the current one)
+  memcpy(&em_avLastPos[0], &em_avPos[0], ctAlive*sizeof(FLOAT3D));
+  memcpy(&em_afLastRot[0], &em_afRot[0], ctAlive*sizeof(FLOAT));
+  memcpy(&em_acolLastColor[0], &em_acolColor[0], ctAlive*sizeof(COLOR));
+
+  // [Cecil] Integrate speed, position and rotation over flat arrays
+  // (time step is zero for particles that aren't alive yet)
+  IntegrateParticles(&em_avSpeed[0](1), &em_avPos[0](1), &em_afRot[0], &em_afRotSpeed[0],
+    &em_atmEmitted[0], ctAlive, em_vG, tmQuantum);
+}
+
+// [Cecil] 2026-10-19: Integrate speed, position and rotation of particles
+// Every value goes through the same single precision operations in the vector and in the scalar parts,
+// so the result doesn't depend on how many particles are processed at once.
+void CEmiter::IntegrateParticles(FLOAT *pfSpeed, FLOAT *pfPos, FLOAT *pfRot, const FLOAT *pfRotSpeed,
+  const FLOAT *ptmEmitted, INDEX ctParticles, const FLOAT3D &vG, FLOAT tmQuantum)
+{
+  INDEX i=0;
+
+#if CECIL_EMITER_SSE
+  const __m128 mZero=_mm_setzero_ps();
+  const __m128 mQuantum=_mm_set1_ps(tmQuantum);
+
+  // gravity for 4 interleaved XYZ vectors spread across 3 registers
+  const FLOAT fGX=vG(1)*tmQuantum;
+  const FLOAT fGY=vG(2)*tmQuantum;
+  const FLOAT fGZ=vG(3)*tmQuantum;
+  const __m128 mG0=_mm_setr_ps(fGX, fGY, fGZ, fGX);
+  const __m128 mG1=_mm_setr_ps(fGY, fGZ, fGX, fGY);
+  const __m128 mG2=_mm_setr_ps(fGZ, fGX, fGY, fGZ);
+
+  for (; i+4<=ctParticles; i+=4)
+  {
+    // mask out particles that aren't alive yet
+    const __m128 mAlive=_mm_cmpge_ps(_mm_loadu_ps(ptmEmitted+i), mZero);
+    const __m128 mAlive0=_mm_shuffle_ps(mAlive, mAlive, _MM_SHUFFLE(1, 0, 0, 0));
+    const __m128 mAlive1=_mm_shuffle_ps(mAlive, mAlive, _MM_SHUFFLE(2, 2, 1, 1));
+    const __m128 mAlive2=_mm_shuffle_ps(mAlive, mAlive, _MM_SHUFFLE(3, 3, 3, 2));
+
+    FLOAT *pfS=pfSpeed+i*3;
+    FLOAT *pfP=pfPos+i*3;
+
+    // animate position
+    __m128 mS0=_mm_add_ps(_mm_loadu_ps(pfS+0), _mm_and_ps(mG0, mAlive0));
+    __m128 mS1=_mm_add_ps(_mm_loadu_ps(pfS+4), _mm_and_ps(mG1, mAlive1));
+    __m128 mS2=_mm_add_ps(_mm_loadu_ps(pfS+8), _mm_and_ps(mG2, mAlive2));
+    _mm_storeu_ps(pfS+0, mS0);
+    _mm_storeu_ps(pfS+4, mS1);
+    _mm_storeu_ps(pfS+8, mS2);
+
+    _mm_storeu_ps(pfP+0, _mm_add_ps(_mm_loadu_ps(pfP+0), _mm_mul_ps(mS0, _mm_and_ps(mQuantum, mAlive0))));
+    _mm_storeu_ps(pfP+4, _mm_add_ps(_mm_loadu_ps(pfP+4), _mm_mul_ps(mS1, _mm_and_ps(mQuantum, mAlive1))));
+    _mm_storeu_ps(pfP+8, _mm_add_ps(_mm_loadu_ps(pfP+8), _mm_mul_ps(mS2, _mm_and_ps(mQuantum, mAlive2))));
+
+    // animate rotation
+    const __m128 mDT=_mm_and_ps(mQuantum, mAlive);
+    _mm_storeu_ps(pfRot+i, _mm_add_ps(_mm_loadu_ps(pfRot+i), _mm_mul_ps(_mm_loadu_ps(pfRotSpeed+i), mDT)));
+  }
+
+  // remaining particles one by one using the same operations
+  for (; i<ctParticles; i++)
   {
-    em_aepParticles.PopAll();
+    const __m128 mAlive=_mm_cmpge_ss(_mm_load_ss(ptmEmitted+i), mZero);
+    const __m128 mDT=_mm_and_ps(mQuantum, mAlive);
+    FLOAT *pfS=pfSpeed+i*3;
+    FLOAT *pfP=pfPos+i*3;
+
+    for (INDEX iAxis=0; iAxis<3; iAxis++) {
+      const __m128 mS=_mm_add_ss(_mm_load_ss(pfS+iAxis), _mm_and_ps(_mm_set_ss(vG(iAxis+1)*tmQuantum), mAlive));
+      _mm_store_ss(pfS+iAxis, mS);
+      _mm_store_ss(pfP+iAxis, _mm_add_ss(_mm_load_ss(pfP+iAxis), _mm_mul_ss(mS, mDT)));
+    }
+
+    _mm_store_ss(pfRot+i, _mm_add_ss(_mm_load_ss(pfRot+i), _mm_mul_ss(_mm_load_ss(pfRotSpeed+i), mDT)));
   }
-  else if( em_aepParticles.Count()!=ctCount)
+
+#else
+  for (; i<ctParticles; i++)
   {
-    em_aepParticles.PopUntil(ctCount-1);
+    const FLOAT fMask=(ptmEmitted[i]<0) ? 0.0f : 1.0f;
+    const FLOAT fDT=fMask*tmQuantum;
+    FLOAT *pfS=pfSpeed+i*3;
+    FLOAT *pfP=pfPos+i*3;
+
+    // animate position
+    for (INDEX iAxis=0; iAxis<3; iAxis++) {
+      pfS[iAxis]+=vG(iAxis+1)*tmQuantum*fMask;
+      pfP[iAxis]+=pfS[iAxis]*fDT;
+    }
+
+    // animate rotation
+    pfRot[i]+=pfRotSpeed[i]*fDT;
   }
+#endif
 }
 
 void CEmiter::RenderParticles(void)
@@ -153,20 +322,32 @@ void CEmiter::Read_t( CTStream &strm)
   strm>>em_colGlobal;
   strm>>em_iGlobal;
 
-  if(ctMaxParticles==0) return;
-  em_aepParticles.Push(ctMaxParticles);
+  // [Cecil] Particles are still saved as structures
+  ClearParticles();
 
-  for(INDEX i=0; i<em_aepParticles.Count(); i++)
+  for(INDEX i=0; i<ctMaxParticles; i++)
   {
-    CEmittedParticle &em=em_aepParticles[i];
+    CEmittedParticle em;
     em.Read_t(strm);
+
+    em_avLastPos.Push()=em.ep_vLastPos;
+    em_avPos.Push()=em.ep_vPos;
+    em_afLastRot.Push()=em.ep_fLastRot;
+    em_afRot.Push()=em.ep_fRot;
+    em_afRotSpeed.Push()=em.ep_fRotSpeed;
+    em_avSpeed.Push()=em.ep_vSpeed;
+    em_acolLastColor.Push()=em.ep_colLastColor;
+    em_acolColor.Push()=em.ep_colColor;
+    em_atmEmitted.Push()=em.ep_tmEmitted;
+    em_atmLife.Push()=em.ep_tmLife;
+    em_afStretch.Push()=em.ep_fStretch;
   }
 }
 
 void CEmiter::Write_t( CTStream &strm)
 {
   if( !em_bInitialized) return;
-  INDEX ctMaxParticles=em_aepParticles.Count();
+  INDEX ctMaxParticles=Count();
   strm.WriteID_t(CChunkID(ID_EMITER_VER));
   strm<<ctMaxParticles;
 
@@ -177,10 +358,158 @@ void CEmiter::Write_t( CTStream &strm)
   strm<<em_colGlobal;
   strm<<em_iGlobal;
 
-  for(INDEX i=0; i<em_aepParticles.Count(); i++)
+  // [Cecil] Particles are still saved as structures
+  for(INDEX i=0; i<ctMaxParticles; i++)
   {
-    CEmittedParticle &em=em_aepParticles[i];
+    CEmittedParticle em;
+    GetParticle(i, em);
     em.Write_t(strm);
   }
 }
 
+// [Cecil] 2026-10-19: Measure particle animation speed
+void CECIL_EmiterBenchmark(INDEX ctParticles)
+{
+  ctParticles=ClampDn(ctParticles, (INDEX)1);
+  const INDEX ctTicks=100;
+  const FLOAT tmNow=_pTimer->CurrentTick();
+  const FLOAT tmQuantum=_pTimer->TickQuantum;
+
+  // Same particles in both layouts
+  CEmiter em;
+  em.em_vG=FLOAT3D(0,-10.0f,0);
+
+  CStaticArray<CEmittedParticle> aep;
+  aep.New(ctParticles);
+
+  for (INDEX i=0; i<ctParticles; i++)
+  {
+    // some particles aren't alive yet and some die halfway through
+    const FLOAT tmBirth=(i%10==0) ? -1.0f : tmNow;
+    const FLOAT tmLife=(i%4==0) ? 0.0f : 1000.0f;
+    const FLOAT3D vPos(FLOAT(i%100), FLOAT(i%37), FLOAT(i%11));
+    const FLOAT3D vSpeed(1.0f, 2.0f, 3.0f);
+
+    em.AddParticle(vPos, vSpeed, 0.0f, 90.0f, tmBirth, tmLife, 1.0f, C_WHITE|CT_OPAQUE);
+
+    CEmittedParticle &ep=aep[i];
+    em.GetParticle(i, ep);
+  }
+
+  // Reference particles that are animated one by one in the same order
+  CStaticStackArray<CEmittedParticle> aepCheck;
+  {for (INDEX i=0; i<ctParticles; i++) {
+    aepCheck.Push()=aep[i];
+  }}
+
+  // Structure of arrays
+  CTimerValue tvStart=_pTimer->GetHighPrecisionTimer();
+
+  for (INDEX iTick=0; iTick<ctTicks; iTick++) {
+    em.AnimateParticles();
+  }
+
+  const DOUBLE dSoA=(_pTimer->GetHighPrecisionTimer()-tvStart).GetSeconds();
+
+  // Array of structures with removal by swapping (previous method)
+  INDEX ctCount=ctParticles;
+  tvStart=_pTimer->GetHighPrecisionTimer();
+
+  for (INDEX iTick=0; iTick<ctTicks; iTick++)
+  {
+    INDEX iCurrent=0;
+    while (iCurrent<ctCount)
+    {
+      CEmittedParticle &ep=aep[iCurrent];
+
+      if (ep.ep_tmEmitted<0) {
+        iCurrent++;
+
+      } else if (tmNow>ep.ep_tmEmitted+ep.ep_tmLife) {
+        ep=aep[ctCount-1];
+        ctCount--;
+
+      } else {
+        ep.ep_vLastPos=ep.ep_vPos;
+        ep.ep_vSpeed=ep.ep_vSpeed+em.em_vG*tmQuantum;
+        ep.ep_vPos=ep.ep_vPos+ep.ep_vSpeed*tmQuantum;
+        ep.ep_fLastRot=ep.ep_fRot;
+        ep.ep_fRot+=ep.ep_fRotSpeed*tmQuantum;
+        ep.ep_colLastColor=ep.ep_colColor;
+        iCurrent++;
+      }
+    }
+  }
+
+  const DOUBLE dAoS=(_pTimer->GetHighPrecisionTimer()-tvStart).GetSeconds();
+
+  // Animate reference particles without reordering them
+  for (INDEX iTick=0; iTick<ctTicks; iTick++)
+  {
+    INDEX ctAlive=0;
+
+    for (INDEX i=0; i<aepCheck.Count(); i++)
+    {
+      CEmittedParticle ep=aepCheck[i];
+
+      // dead
+      if (ep.ep_tmEmitted>=0 && tmNow>ep.ep_tmEmitted+ep.ep_tmLife) {
+        continue;
+      }
+
+      ep.ep_vLastPos=ep.ep_vPos;
+      ep.ep_fLastRot=ep.ep_fRot;
+      ep.ep_colLastColor=ep.ep_colColor;
+
+      if (ep.ep_tmEmitted>=0) {
+        ep.ep_vSpeed=ep.ep_vSpeed+em.em_vG*tmQuantum;
+        ep.ep_vPos=ep.ep_vPos+ep.ep_vSpeed*tmQuantum;
+        ep.ep_fRot+=ep.ep_fRotSpeed*tmQuantum;
+      }
+
+      aepCheck[ctAlive++]=ep;
+    }
+
+    if (ctAlive==0) {
+      aepCheck.PopAll();
+    } else {
+      aepCheck.PopUntil(ctAlive-1);
+    }
+  }
+
+  // Every animated particle must match its reference exactly
+  INDEX ctMismatches=0;
+
+  if (aepCheck.Count()!=em.Count()) {
+    ctMismatches=Abs(aepCheck.Count()-em.Count());
+  }
+
+  const INDEX ctCompare=Min(aepCheck.Count(), em.Count());
+
+  for (INDEX iCheck=0; iCheck<ctCompare; iCheck++)
+  {
+    const CEmittedParticle &epCheck=aepCheck[iCheck];
+    CEmittedParticle ep;
+    em.GetParticle(iCheck, ep);
+
+    if (ep.ep_vPos!=epCheck.ep_vPos || ep.ep_vLastPos!=epCheck.ep_vLastPos
+     || ep.ep_vSpeed!=epCheck.ep_vSpeed
+     || ep.ep_fRot!=epCheck.ep_fRot || ep.ep_fLastRot!=epCheck.ep_fLastRot) {
+      ctMismatches++;
+    }
+  }
+
+  if (ctCount!=em.Count()) {
+    ctMismatches++;
+  }
+
+  CPrintF("Animated %d particles for %d ticks (%d left alive):\n", ctParticles, ctTicks, em.Count());
+  CPrintF("  Separate arrays: %.3f ms\n", dSoA*1000.0);
+  CPrintF("  Structures:      %.3f ms\n", dAoS*1000.0);
+
+  if (ctMismatches==0) {
+    CPrintF("^c00ff00PASS^r: all particles match the reference\n");
+  } else {
+    CPrintF("^cff0000FAIL^r: %d mismatching particles (%d and %d left alive)\n", ctMismatches, em.Count(), ctCount);
+  }
+}
@@ -25,6 +25,7 @@ public:
   void Write_t( CTStream &strm);
 };
 
+// [Cecil] 2026-10-19: Particle fields are stored in separate arrays for faster animation
 class DECL_DLL CEmiter {
 public:
   enum CEmiterType em_etType;
@@ -34,7 +35,19 @@ public:
   FLOAT3D em_vG;
   COLOR em_colGlobal;
   INDEX em_iGlobal;
-  CStaticStackArray<CEmittedParticle> em_aepParticles;
+
+  // [Cecil] Particle fields (see CEmittedParticle)
+  CStaticStackArray<FLOAT3D> em_avLastPos;
+  CStaticStackArray<FLOAT3D> em_avPos;
+  CStaticStackArray<FLOAT> em_afLastRot;
+  CStaticStackArray<FLOAT> em_afRot;
+  CStaticStackArray<FLOAT> em_afRotSpeed;
+  CStaticStackArray<FLOAT3D> em_avSpeed;
+  CStaticStackArray<COLOR> em_acolLastColor;
+  CStaticStackArray<COLOR> em_acolColor;
+  CStaticStackArray<FLOAT> em_atmEmitted;
+  CStaticStackArray<FLOAT> em_atmLife;
+  CStaticStackArray<FLOAT> em_afStretch;
 
   /* Default constructor. */
   CEmiter(void);
@@ -46,5 +59,26 @@ public:
     FLOAT tmBirth, FLOAT tmLife, FLOAT fStretch, COLOR colColor);
   void Read_t( CTStream &strm);
   void Write_t( CTStream &strm);
+
+  // [Cecil] Amount of particles
+  inline INDEX Count(void) const {
+    return em_atmEmitted.Count();
+  };
+
+  // [Cecil] Remove all particles
+  void ClearParticles(void);
+
+  // [Cecil] Get particle in one structure
+  void GetParticle(INDEX i, CEmittedParticle &ep) const;
+
+private:
+  // [Cecil] Remove particles after the first ones
+  void PopParticles(INDEX ctKeep);
+
+  // [Cecil] Integrate speed, position and rotation of particles
+  static void IntegrateParticles(FLOAT *pfSpeed, FLOAT *pfPos, FLOAT *pfRot, const FLOAT *pfRotSpeed,
+    const FLOAT *ptmEmitted, INDEX ctParticles, const FLOAT3D &vG, FLOAT tmQuantum);
 };
 
+// [Cecil] 2026-10-19: Measure particle animation speed
+DECL_DLL void CECIL_EmiterBenchmark(INDEX ctParticles);
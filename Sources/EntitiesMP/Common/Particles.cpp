@@ -2508,11 +2508,239 @@ void Particles_Ghostbuster(const FLOAT3D &vSrc, const FLOAT3D &vDst, INDEX ctRay
 
 // growth - one for each drawport
 
-static int qsort_CompareGrowth(const void *pvGrowth0, const void *pvGrowth1)
+// [Cecil] 2026-10-19: Growth map parameters that are shared by all cells
+struct SGrowthParams {
+  CEnvironmentParticlesHolder *eph;
+  CTextureData *ptdMap;
+  FLOATaabbox3D boxMap;
+  PIX pixMapW;
+  PIX pixMapH;
+  BOOL bHighres;
+  FLOAT fGridStep;
+  FLOAT fStep;
+  FLOAT fStepSqrt;
+  INDEX iGridHalf; // cells from the center to the edge
+
+  FLOAT f1oGridSizeX;
+  FLOAT f1oGridSizeZ;
+  FLOAT f1oGridStepX;
+  FLOAT f1oGridStepZ;
+  FLOAT fSlopeMul;
+  ULONG ulHeightMask;
+
+  // Setup parameters for the current growth settings
+  BOOL Setup(CEnvironmentParticlesHolder *penEPH, CTextureData *ptdGrowthMap, const FLOATaabbox3D &boxGrowthMap);
+
+  // Snap viewer position to the grid
+  FLOAT3D Snap(const FLOAT3D &vPos) const {
+    FLOAT3D vSnapped = vPos;
+    SnapFloat(vSnapped(1), fGridStep);
+    SnapFloat(vSnapped(3), fGridStep);
+    vSnapped(2) = 0.0f;
+    return vSnapped;
+  };
+};
+
+BOOL SGrowthParams::Setup(CEnvironmentParticlesHolder *penEPH, CTextureData *ptdGrowthMap, const FLOATaabbox3D &boxGrowthMap)
 {
-  FLOAT ret = (((CGrowth *)pvGrowth1)->fDistanceToViewer -
-      ((CGrowth *)pvGrowth0)->fDistanceToViewer) * 1000;
-  return FloatToInt(ret);
+  if (ptdGrowthMap == NULL) {
+    return FALSE;
+  }
+
+  eph = penEPH;
+  ptdMap = ptdGrowthMap;
+  boxMap = boxGrowthMap;
+  pixMapW = ptdGrowthMap->GetPixWidth();
+  pixMapH = ptdGrowthMap->GetPixHeight();
+  bHighres = eph->m_bGrowthHighresMap;
+  fGridStep = eph->m_fGrowthRenderingStep;
+
+  // calculate step
+  extern FLOAT gfx_fEnvParticlesDensity;
+  gfx_fEnvParticlesDensity = Clamp(gfx_fEnvParticlesDensity, 0.0f, 1.0f);
+  if (gfx_fEnvParticlesDensity<=0) {
+    fStep = 0;
+  } else {
+    fStep = 1/gfx_fEnvParticlesDensity;
+  }
+  fStepSqrt = Sqrt(fStep);
+
+  FLOAT fRangeMod = Clamp(gfx_fEnvParticlesRange, 0.1f, 2.0f);
+  FLOAT GROWTH_RENDERING_RADIUS_OPAQUE = (eph->m_fGrowthRenderingRadius - eph->m_fGrowthRenderingRadiusFade)*fRangeMod;
+  FLOAT GROWTH_RENDERING_RADIUS_FADE = eph->m_fGrowthRenderingRadius*fRangeMod;
+  ASSERT(GROWTH_RENDERING_RADIUS_FADE>=GROWTH_RENDERING_RADIUS_OPAQUE);
+  iGridHalf = GROWTH_RENDERING_RADIUS_FADE/fGridStep;
+
+  f1oGridSizeX = 1.0f/boxMap.Size()(1);
+  f1oGridSizeZ = 1.0f/boxMap.Size()(3);
+  f1oGridStepX = 1.0f/(boxMap.Size()(1)/pixMapW);
+  f1oGridStepZ = 1.0f/(boxMap.Size()(3)/pixMapH);
+
+  // calculate maximum slope per meter on each axis
+  if (bHighres) {
+    fSlopeMul = boxMap.Size()(2)/65535.0f;
+    ulHeightMask = 0xFFFF;
+  } else {
+    fSlopeMul = boxMap.Size()(2)/255.0f;
+    ulHeightMask = 0xFF;
+  }
+  return TRUE;
+}
+
+// [Cecil] 2026-10-19: Calculate growth in one absolute grid cell (no shade if there's none)
+static void CalculateGrowthCell(const SGrowthParams &gp, INDEX iCellX, INDEX iCellZ, CGrowth &cgParticle)
+{
+  cgParticle.ubShade = 0;
+
+  double fmodi = fabs(fmod((double)iCellX, (double)gp.fStepSqrt));
+  double fmodj = fabs(fmod((double)iCellZ, (double)gp.fStepSqrt));
+  if ( fmodi>=1 || fmodj>=1) {
+    return;
+  }
+
+  // absolute positions :
+  INDEX i = INDEX(iCellX*gp.fGridStep);
+  INDEX j = INDEX(iCellZ*gp.fGridStep);
+
+  // apply a bit of randomness:
+  const ULONG fXSpan = 1234;
+  UBYTE ubRndFact = (i*fXSpan+j)%CT_MAX_PARTICLES_TABLE;
+
+  FLOAT iR, jR;
+  iR = (FLOAT)i + gp.fGridStep * afStarsPositions[ubRndFact][0];
+  jR = (FLOAT)j + gp.fGridStep * afStarsPositions[ubRndFact][2];
+
+  // size: 
+  cgParticle.fSize = Lerp(gp.eph->m_fGrowthMinSize, gp.eph->m_fGrowthMaxSize, 
+    afStarsPositions[ubRndFact][2]+0.5f);
+
+  FLOAT texX = (iR-gp.boxMap.Min()(1))*gp.f1oGridSizeX*gp.pixMapW;
+  FLOAT texY = (jR-gp.boxMap.Min()(3))*gp.f1oGridSizeZ*gp.pixMapH;
+
+  // particles that fall outside the boundaries are not visible
+  if (!((texX>0) && (texX<gp.pixMapW) && (texY>0) && (texY<gp.pixMapH))) {
+    return;
+  }
+
+  // bilinear sampling of height data
+  texX -= 0.5f;
+  texY -= 0.5f;
+  ULONG ulX1 = FloatToInt(floorf(texX));
+  ULONG ulX2 = FloatToInt(ceilf(texX));
+  ULONG ulY1 = FloatToInt(floorf(texY));
+  ULONG ulY2 = FloatToInt(ceilf(texY));
+
+  // [Cecil] Sample each texel only once
+  const ULONG ulTmp = gp.ptdMap->GetTexel(ulX1, ulY1);
+  SLONG ulUL = (ulTmp>>8)&gp.ulHeightMask;
+  SLONG ulUR = (gp.ptdMap->GetTexel(ulX2, ulY1)>>8)&gp.ulHeightMask;
+  SLONG ulBL = (gp.ptdMap->GetTexel(ulX1, ulY2)>>8)&gp.ulHeightMask;
+  SLONG ulBR = (gp.ptdMap->GetTexel(ulX2, ulY2)>>8)&gp.ulHeightMask;
+
+  // bilinear formula
+  FLOAT fDX = texX - ulX1;
+  FLOAT fDY = texY - ulY1;
+  FLOAT fRawHeight = ulUL*(1-fDX)*(1-fDY) +
+                     ulUR*(fDX - fDX*fDY) +
+                     ulBL*(fDY - fDX*fDY) +
+                     ulBR*(fDX*fDY);
+
+  FLOAT fSlopeX = Max(Abs(ulUL-ulUR), Abs(ulBL-ulBR))*gp.fSlopeMul;
+  FLOAT fSlopeY = Max(Abs(ulUL-ulBL), Abs(ulUR-ulBR))*gp.fSlopeMul;
+  fSlopeX*=gp.f1oGridStepX;
+  fSlopeY*=gp.f1oGridStepZ;
+
+  // clamp to terrain height  
+  FLOAT fHeight = gp.boxMap.Min()(2) + fRawHeight*gp.fSlopeMul;
+  if (gp.bHighres) {
+    fHeight += cgParticle.fSize;
+  }
+
+  // apply sink factor
+  fHeight -= gp.eph->m_fParticlesSinkFactor*cgParticle.fSize*2.0f;
+  // also sink by maximum slope
+  FLOAT fSlopeSink = Max(fSlopeX, fSlopeY);
+  if (fSlopeSink>1.5f) {
+    return; // if too great slope, don't render it
+  }
+  fHeight -= cgParticle.fSize*fSlopeSink*0.75f; // don't sink too much
+
+  cgParticle.vRender = FLOAT3D (iR, fHeight, jR);
+
+  ULONG ulType = (((ulTmp>>24)&0xFF)*(gp.eph->m_iGrowthMapX*gp.eph->m_iGrowthMapY))>>8;
+  cgParticle.iShapeX = ulType % gp.eph->m_iGrowthMapX;
+  cgParticle.iShapeY = ulType / gp.eph->m_iGrowthMapX;
+
+  cgParticle.ubShade = (ulTmp)&0xFF;
+}
+
+// [Cecil] 2026-10-19: Wrap absolute cell index into the cache grid
+static inline INDEX WrapGrowthCell(INDEX iCell, INDEX ctSide)
+{
+  INDEX i = iCell % ctSide;
+  return (i < 0) ? i + ctSide : i;
+}
+
+// [Cecil] 2026-10-19: Recalculate cells of the cache around the snapped position
+// (only cells that weren't in the grid before, unless it needs to be fully rebuilt)
+// Returns amount of recalculated cells
+static INDEX RebuildGrowthCache(CGrowthCache &cgc, const SGrowthParams &gp, const FLOAT3D &vSnapped, BOOL bFull)
+{
+  const INDEX ctSide = gp.iGridHalf*2+1;
+
+  // settings have changed
+  if (!cgc.bValid || cgc.iGridSide!=ctSide || cgc.fStep!=gp.fStep || cgc.ptdMap!=gp.ptdMap
+   || !(cgc.boxMap.Min()==gp.boxMap.Min()) || !(cgc.boxMap.Max()==gp.boxMap.Max())) {
+    bFull = TRUE;
+  }
+
+  cgc.vLastPos = vSnapped;
+  cgc.fStep = gp.fStep;
+  cgc.ptdMap = gp.ptdMap;
+  cgc.boxMap = gp.boxMap;
+
+  if (gp.fStep<1) {
+    cgc.acgParticles.PopAll();
+    cgc.bValid = FALSE;
+    return 0;
+  }
+
+  if (bFull) {
+    cgc.iGridSide = ctSide;
+    cgc.acgParticles.PopAll();
+    cgc.acgParticles.Push(ctSide*ctSide);
+  }
+
+  const INDEX iOldX0 = cgc.iCellX0;
+  const INDEX iOldZ0 = cgc.iCellZ0;
+
+  cgc.iCellX0 = FloatToInt(vSnapped(1)/gp.fGridStep) - gp.iGridHalf;
+  cgc.iCellZ0 = FloatToInt(vSnapped(3)/gp.fGridStep) - gp.iGridHalf;
+  cgc.bValid = TRUE;
+
+  INDEX ctRebuilt = 0;
+
+  for (INDEX iZ = 0; iZ < ctSide; iZ++)
+  {
+    const INDEX iCellZ = cgc.iCellZ0 + iZ;
+    const BOOL bOldRow = !bFull && iCellZ>=iOldZ0 && iCellZ<iOldZ0+ctSide;
+    CGrowth *pcgRow = &cgc.acgParticles[WrapGrowthCell(iCellZ, ctSide)*ctSide];
+
+    for (INDEX iX = 0; iX < ctSide; iX++)
+    {
+      const INDEX iCellX = cgc.iCellX0 + iX;
+
+      // still cached
+      if (bOldRow && iCellX>=iOldX0 && iCellX<iOldX0+ctSide) {
+        continue;
+      }
+
+      CalculateGrowthCell(gp, iCellX, iCellZ, pcgRow[WrapGrowthCell(iCellX, ctSide)]);
+      ctRebuilt++;
+    }
+  }
+
+  return ctRebuilt;
 }
 
 BOOL UpdateGrowthCache(CEntity *pen, CTextureData *ptdGrowthMap, FLOATaabbox3D &boxGrowthMap, CEntity *penEPH, INDEX iDrawPort)
@@ -2530,61 +2758,15 @@ BOOL UpdateGrowthCache(CEntity *pen, CTextureData *ptdGrowthMap, FLOATaabbox3D &
     return FALSE;
   }
 
-  // calculate step
-  extern FLOAT gfx_fEnvParticlesDensity;
-  gfx_fEnvParticlesDensity = Clamp(gfx_fEnvParticlesDensity, 0.0f, 1.0f);
-  FLOAT fStep = 1.0f;
-  if (gfx_fEnvParticlesDensity<=0) {
-    fStep = 0;
-  } else {
-    fStep = 1/gfx_fEnvParticlesDensity;
+  // [Cecil] Gather growth parameters
+  SGrowthParams gp;
+  if (!gp.Setup(eph, ptdGrowthMap, boxGrowthMap)) {
+    return FALSE;
   }
 
-  FLOAT GROWTH_RENDERING_STEP = eph->m_fGrowthRenderingStep;  
-
-  // viewer absolute position
-  FLOAT3D vPos = prPlayerProjection->pr_vViewerPosition;
-  // snap viewer to grid
-  FLOAT3D vSnapped = vPos;
-  SnapFloat(vSnapped(1), GROWTH_RENDERING_STEP);
-  SnapFloat(vSnapped(3), GROWTH_RENDERING_STEP);
-  vSnapped(2) = 0.0f;
+  // viewer absolute position snapped to grid
+  FLOAT3D vSnapped = gp.Snap(prPlayerProjection->pr_vViewerPosition);
 
-  PIX pixGrowthMapH;
-  PIX pixGrowthMapW;
-  
-  if( ptdGrowthMap  != NULL)
-  {
-    pixGrowthMapW = ptdGrowthMap->GetPixWidth();
-    pixGrowthMapH = ptdGrowthMap->GetPixHeight();
-  } else {
-    return FALSE;
-  }
-  
-  FLOAT3D vRender;
-  FLOAT texX; 
-  FLOAT texY;
-  FLOAT fRawHeight;
-  
-  FLOAT fRangeMod = Clamp(gfx_fEnvParticlesRange, 0.1f, 2.0f);
-  FLOAT GROWTH_RENDERING_RADIUS_OPAQUE = (eph->m_fGrowthRenderingRadius - eph->m_fGrowthRenderingRadiusFade)*fRangeMod;
-  FLOAT GROWTH_RENDERING_RADIUS_FADE = eph->m_fGrowthRenderingRadius*fRangeMod;
-  BOOL  GROWTH_HIGHRES_MAP = eph->m_bGrowthHighresMap;
-  
-  ASSERT(GROWTH_RENDERING_RADIUS_FADE>=GROWTH_RENDERING_RADIUS_OPAQUE);
-  
-  FLOAT fGridStep;
-  ULONG fXSpan;
-  UBYTE ubFade=0xff;
-  
-  fGridStep = GROWTH_RENDERING_STEP;
-  fXSpan = 1234;
-  
-  INDEX iGridX1 = GROWTH_RENDERING_RADIUS_FADE/GROWTH_RENDERING_STEP;
-  INDEX iGridX0 = -iGridX1;
-  INDEX iGridY1 = iGridX1;
-  INDEX iGridY0 = -iGridX1;
-    
   // find growth cache and check if it is initialised
   CGrowthCache *cgc = NULL;
   {FOREACHINLIST(CGrowthCache, cgc_Node, eph->lhCache, itCache)
@@ -2595,151 +2777,143 @@ BOOL UpdateGrowthCache(CEntity *pen, CTextureData *ptdGrowthMap, FLOATaabbox3D &
   {
     cgc = new(CGrowthCache);
     cgc->ulID = iDrawPort;
-    cgc->iGridSide = iGridX1*2+1;
-    cgc->vLastPos = vSnapped;
     eph->lhCache.AddTail(cgc->cgc_Node);
     //CPrintF("added ph %s \n", eph->GetName());
   } else {
-    if (cgc->vLastPos==vSnapped && cgc->fStep==fStep) {
-      cgc->vLastPos = vSnapped;
+    if (cgc->bValid && cgc->vLastPos==vSnapped && cgc->fStep==gp.fStep) {
       return TRUE;
     }
-    //CPrintF("need recashe! at %f\n", _pTimer->CurrentTick());
-    cgc->vLastPos = vSnapped;
-    cgc->fStep = fStep;
   }
 
-  cgc->acgParticles.PopAll();
-  CGrowth cgParticle;
+  // [Cecil] Only recalculate newly exposed cells
+  RebuildGrowthCache(*cgc, gp, vSnapped, FALSE);
+  return TRUE;
+}
 
-  if (fStep<1) {
-    return TRUE;
+// [Cecil] 2026-10-19: Order growth from the farthest to the nearest using distance buckets
+#define GROWTH_SORT_BUCKETS 1024
+
+static void SortGrowthByDistance(CStaticStackArray<CGrowth> &acg, FLOAT fMaxDistance)
+{
+  static CStaticStackArray<CGrowth> acgSorted;
+  static CStaticStackArray<INDEX> aiBuckets;
+  static INDEX aiBucketStart[GROWTH_SORT_BUCKETS+1];
+
+  const INDEX ct = acg.Count();
+  if (ct<=1) {
+    return;
   }
 
-  INDEX iOffI = FloatToInt(vSnapped(1)/GROWTH_RENDERING_STEP);
-  INDEX iOffJ = FloatToInt(vSnapped(3)/GROWTH_RENDERING_STEP);
+  const FLOAT fToBucket = GROWTH_SORT_BUCKETS/ClampDn(fMaxDistance, 0.001f);
+  memset(aiBucketStart, 0, sizeof(aiBucketStart));
 
-  FLOAT fStepSqrt = Sqrt(fStep);
-  FLOAT f1oGridSizeX = 1.0f/boxGrowthMap.Size()(1);
-  FLOAT f1oGridSizeZ = 1.0f/boxGrowthMap.Size()(3);
-  FLOAT f1oGridStepX = 1.0f/(boxGrowthMap.Size()(1)/pixGrowthMapW);
-  FLOAT f1oGridStepZ = 1.0f/(boxGrowthMap.Size()(3)/pixGrowthMapH);
+  aiBuckets.PopAll();
+  aiBuckets.Push(ct);
 
-  // loop through the whole particle grid
-  for ( INDEX iC=iGridY0; iC<iGridY1+1; iC++ )
+  INDEX i;
+
+  // count growth in each bucket (farthest buckets go first)
+  for (i=0; i<ct; i++) {
+    INDEX iBucket = Clamp(INDEX(acg[i].fDistanceToViewer*fToBucket), (INDEX)0, (INDEX)GROWTH_SORT_BUCKETS-1);
+    iBucket = GROWTH_SORT_BUCKETS-1-iBucket;
+
+    aiBuckets[i] = iBucket;
+    aiBucketStart[iBucket+1]++;
+  }
+
+  for (i=0; i<GROWTH_SORT_BUCKETS; i++) {
+    aiBucketStart[i+1] += aiBucketStart[i];
+  }
+
+  // place growth into its bucket
+  acgSorted.PopAll();
+  acgSorted.Push(ct);
+
+  for (i=0; i<ct; i++) {
+    acgSorted[aiBucketStart[aiBuckets[i]]++] = acg[i];
+  }
+
+  memcpy(&acg[0], &acgSorted[0], ct*sizeof(CGrowth));
+}
+
+// [Cecil] 2026-10-19: Measure growth cache rebuilding along a camera path
+void CECIL_GrowthBenchmark(INDEX ctSteps)
+{
+  ctSteps = ClampDn(ctSteps, (INDEX)2);
+
+  // find first growth holder with a growth map
+  CEnvironmentParticlesHolder *eph = NULL;
+  CTextureData *ptdMap = NULL;
+  FLOATaabbox3D boxMap;
+
+  {FOREACHINDYNAMICCONTAINER(_pNetwork->ga_World.wo_cenEntities, CEntity, iten) {
+    if (!IsOfClass(iten, "EnvironmentParticlesHolder")) continue;
+
+    CEnvironmentParticlesHolder *penHolder = (CEnvironmentParticlesHolder *)&*iten;
+    if (penHolder->m_eptType != EPTH_GROWTH) continue;
+
+    penHolder->GetHeightMapData(ptdMap, boxMap);
+
+    if (ptdMap != NULL) {
+      eph = penHolder;
+      break;
+    }
+  }}
+
+  SGrowthParams gp;
+
+  if (eph == NULL || !gp.Setup(eph, ptdMap, boxMap)) {
+    CPrintF("No growth map in the current world!\n");
+    return;
+  }
+
+  if (gp.fStep<1) {
+    CPrintF("Growth is disabled (gfx_fEnvParticlesDensity is 0)!\n");
+    return;
+  }
+
+  // walk diagonally across the growth map
+  const FLOAT3D vStart = boxMap.Min();
+  const FLOAT3D vEnd = boxMap.Max();
+
+  CGrowthCache cgcFull, cgcIncremental;
+  INDEX ctFullCells = 0;
+  INDEX ctIncrementalCells = 0;
+
+  for (INDEX iPass = 0; iPass < 2; iPass++)
   {
-    for ( INDEX jC=iGridX0; jC<iGridX1+1; jC++ )
+    const BOOL bFull = (iPass == 0);
+    CGrowthCache &cgc = (bFull ? cgcFull : cgcIncremental);
+    INDEX &ctCells = (bFull ? ctFullCells : ctIncrementalCells);
+
+    CTimerValue tvStart = _pTimer->GetHighPrecisionTimer();
+
+    for (INDEX iStep = 0; iStep < ctSteps; iStep++)
     {
-      double fmodi = fabs(fmod(iC+iOffI, fStepSqrt));
-      double fmodj = fabs(fmod(jC+iOffJ, fStepSqrt));
-      if ( fmodi>=1 || fmodj>=1) {
-        continue;
-      }
+      const FLOAT3D vPos = Lerp(vStart, vEnd, FLOAT(iStep)/FLOAT(ctSteps-1));
+      const FLOAT3D vSnapped = gp.Snap(vPos);
 
-      // absolute positions :
-      INDEX i = iC*GROWTH_RENDERING_STEP + vSnapped(1);
-      INDEX j = jC*GROWTH_RENDERING_STEP + vSnapped(3);
+      if (cgc.bValid && cgc.vLastPos == vSnapped) continue;
+      ctCells += RebuildGrowthCache(cgc, gp, vSnapped, bFull);
+    }
 
-            
-      // apply a bit of randomness:
-      UBYTE ubRndFact = (i*fXSpan+j)%CT_MAX_PARTICLES_TABLE;
-            
-      FLOAT iR, jR;
-      iR = (FLOAT)i + fGridStep * afStarsPositions[ubRndFact][0];
-      jR = (FLOAT)j + fGridStep * afStarsPositions[ubRndFact][2];
-      
-      // size: 
-      cgParticle.fSize = Lerp(eph->m_fGrowthMinSize, eph->m_fGrowthMaxSize, 
-        afStarsPositions[ubRndFact][2]+0.5f);
-      
-      texX = (iR-boxGrowthMap.Min()(1))*f1oGridSizeX*pixGrowthMapW;
-      texY = (jR-boxGrowthMap.Min()(3))*f1oGridSizeZ*pixGrowthMapH;
-      
-      // particles that fall inside the boundaries
-      if ((texX>0) && (texX<pixGrowthMapW) && (texY>0) && (texY<pixGrowthMapH))
-      {
-        // bilinear sampling of height data
-        texX -= 0.5f;
-        texY -= 0.5f;
-        ULONG ulX1 = FloatToInt(floorf(texX));
-        ULONG ulX2 = FloatToInt(ceilf(texX));  // if (ulX2>=pixGrowthMapW) ulX2=pixGrowthMapW-1;
-        ULONG ulY1 = FloatToInt(floorf(texY));
-        ULONG ulY2 = FloatToInt(ceilf(texY));  // if (ulY2>=pixGrowthMapH) ulY2=pixGrowthMapH-1;
-        
-        SLONG ulUL, ulUR, ulBL, ulBR;
-        if (GROWTH_HIGHRES_MAP)
-        {
-          ulUL = (ptdGrowthMap->GetTexel(ulX1, ulY1)>>8)&0xFFFF; 
-          ulUR = (ptdGrowthMap->GetTexel(ulX2, ulY1)>>8)&0xFFFF; 
-          ulBL = (ptdGrowthMap->GetTexel(ulX1, ulY2)>>8)&0xFFFF; 
-          ulBR = (ptdGrowthMap->GetTexel(ulX2, ulY2)>>8)&0xFFFF; 
-        }
-        else
-        {
-          ulUL = (ptdGrowthMap->GetTexel(ulX1, ulY1)>>8)&0xFF; 
-          ulUR = (ptdGrowthMap->GetTexel(ulX2, ulY1)>>8)&0xFF; 
-          ulBL = (ptdGrowthMap->GetTexel(ulX1, ulY2)>>8)&0xFF; 
-          ulBR = (ptdGrowthMap->GetTexel(ulX2, ulY2)>>8)&0xFF; 
-        }
-        
-        // bilinear formula
-        FLOAT fDX = texX - ulX1;
-        FLOAT fDY = texY - ulY1;
-        fRawHeight = ulUL*(1-fDX)*(1-fDY) +
-						         ulUR*(fDX - fDX*fDY) +
-						         ulBL*(fDY - fDX*fDY) +
-						         ulBR*(fDX*fDY);
+    const DOUBLE dTime = (_pTimer->GetHighPrecisionTimer() - tvStart).GetSeconds();
+    CPrintF("  %s rebuild: %.3f ms (%d cells)\n", (bFull ? "Full" : "Incremental"), dTime*1000.0, ctCells);
+  }
 
-        // calculate maximum slope per meter on each axis
-        FLOAT fSlopeMul = 1.0f;
-        if (GROWTH_HIGHRES_MAP) {
-          fSlopeMul = boxGrowthMap.Size()(2)/65535.0f;
-        } else {
-          fSlopeMul = boxGrowthMap.Size()(2)/255.0f;
-        }
-        FLOAT fSlopeX = Max(Abs(ulUL-ulUR), Abs(ulBL-ulBR))*fSlopeMul;
-        FLOAT fSlopeY = Max(Abs(ulUL-ulBL), Abs(ulUR-ulBR))*fSlopeMul;
-        //CPrintF("%g %g\n", fSlopeX, fSlopeY);
-        fSlopeX*=f1oGridStepX;
-        fSlopeY*=f1oGridStepZ;
-                
-        // clamp to terrain height  
-        FLOAT fHeight;
-        if (GROWTH_HIGHRES_MAP)
-        {
-          fHeight = boxGrowthMap.Min()(2) + fRawHeight*boxGrowthMap.Size()(2)/65535.0f + cgParticle.fSize;
-        }
-        else
-        {
-          fHeight = boxGrowthMap.Min()(2) + fRawHeight*boxGrowthMap.Size()(2)/255.0f;
-        }
-        // apply sink factor
-        fHeight -= eph->m_fParticlesSinkFactor*cgParticle.fSize*2.0f;
-        // also sink by maximum slope
-        FLOAT fSlopeSink = Max(fSlopeX, fSlopeY);
-        if (fSlopeSink>1.5f) {
-          continue; // if too great slope, don't render it
-        }
-        fHeight -= cgParticle.fSize*fSlopeSink*0.75f; // don't sink too much
-        
-        cgParticle.vRender = FLOAT3D (iR, fHeight, jR);
-        
-        ULONG ulTmp = ptdGrowthMap->GetTexel(ulX1, ulY1); 
-        ULONG ulType = (((ulTmp>>24)&0xFF)*(eph->m_iGrowthMapX*eph->m_iGrowthMapY))>>8;
-        cgParticle.iShapeX = ulType % eph->m_iGrowthMapX;
-        cgParticle.iShapeY = ulType / eph->m_iGrowthMapX;
+  // both caches should end up the same
+  INDEX ctMismatches = 0;
 
-        cgParticle.ubShade = (ulTmp)&0xFF; 
+  for (INDEX i = 0; i < cgcFull.acgParticles.Count(); i++) {
+    const CGrowth &cg0 = cgcFull.acgParticles[i];
+    const CGrowth &cg1 = cgcIncremental.acgParticles[i];
 
-        cgc->acgParticles.Push() = cgParticle;
-      // these particles are not visible
-      } else {
-        cgParticle.ubShade = 0;
-        cgc->acgParticles.Push() = cgParticle;
-      }
+    if (cg0.ubShade != cg1.ubShade || (cg0.ubShade != 0 && !(cg0.vRender == cg1.vRender))) {
+      ctMismatches++;
     }
   }
-  return TRUE;
+
+  CPrintF("Replayed %d camera positions over '%s' (%d mismatching cells)\n", ctSteps, eph->GetName(), ctMismatches);
 }
 
 void Particles_Growth(CEntity *pen, CTextureData *ptdGrowthMap, FLOATaabbox3D &boxGrowthMap, CEntity *penEPH, INDEX iDrawPort)
@@ -2801,7 +2975,7 @@ void Particles_Growth(CEntity *pen, CTextureData *ptdGrowthMap, FLOATaabbox3D &b
     return;
   }
   // sort particles from the farthest to the nearest
-  qsort(&acgDraw[0], acgDraw.sa_UsedCount, sizeof(CGrowth), qsort_CompareGrowth);
+  SortGrowthByDistance(acgDraw, GROWTH_RENDERING_RADIUS_FADE); // [Cecil]
   
   // render particles
   Particle_PrepareTexture( &(eph->m_moParticleTextureHolder.mo_toTexture), PBT_BLEND);
@@ -5504,15 +5678,16 @@ void Particles_SummonerStaff(CEmiter &em)
   ULONG *pcol=pTD->GetRowPointer(0); // flare rnd color
 
   FLOAT fLerpFactor=_pTimer->GetLerpFactor();
-  for(INDEX i=0; i<em.em_aepParticles.Count(); i++)
+  for(INDEX i=0; i<em.Count(); i++)
   {
-    const CEmittedParticle &ep=em.em_aepParticles[i];
-    if(ep.ep_tmEmitted<0) continue;
-    FLOAT3D vPos=Lerp(ep.ep_vLastPos, ep.ep_vPos, fLerpFactor);
-    FLOAT fRot=Lerp(ep.ep_fLastRot, ep.ep_fRot, fLerpFactor);
-    INDEX iIndex=Clamp((tmNow-ep.ep_tmEmitted)/(ep.ep_tmLife)*255.0f,0.0f,255.0f);
+    // [Cecil] Separate particle fields
+    const FLOAT tmEmitted=em.em_atmEmitted[i];
+    if(tmEmitted<0) continue;
+    FLOAT3D vPos=Lerp(em.em_avLastPos[i], em.em_avPos[i], fLerpFactor);
+    FLOAT fRot=Lerp(em.em_afLastRot[i], em.em_afRot[i], fLerpFactor);
+    INDEX iIndex=Clamp((tmNow-tmEmitted)/(em.em_atmLife[i])*255.0f,0.0f,255.0f);
     COLOR col=ByteSwap(pcol[iIndex]);
-    Particle_RenderSquare( vPos, 1.0f*ep.ep_fStretch, fRot, col);
+    Particle_RenderSquare( vPos, 1.0f*em.em_afStretch[i], fRot, col);
   }
   // all done
   Particle_Flush();
@@ -5525,17 +5700,18 @@ void Particles_AirElementalBlow(CEmiter &em)
 
   FLOAT tmNow = _pTimer->GetLerpedCurrentTick();
   FLOAT fLerpFactor=_pTimer->GetLerpFactor();
-  for(INDEX i=0; i<em.em_aepParticles.Count(); i++)
+  for(INDEX i=0; i<em.Count(); i++)
   {
-    const CEmittedParticle &ep=em.em_aepParticles[i];
-    FLOAT fRatio=Clamp((tmNow-ep.ep_tmEmitted)/ep.ep_tmLife,0.0f,1.0f);
-    INDEX iRnd =INDEX(ep.ep_tmEmitted*123345)%CT_MAX_PARTICLES_TABLE;
+    // [Cecil] Separate particle fields
+    const FLOAT tmEmitted=em.em_atmEmitted[i];
+    FLOAT fRatio=Clamp((tmNow-tmEmitted)/em.em_atmLife[i],0.0f,1.0f);
+    INDEX iRnd =INDEX(tmEmitted*123345)%CT_MAX_PARTICLES_TABLE;
     INDEX iFrame=1+iRnd%3;
     Particle_SetTexturePart( 128, 128, iFrame, 0);
 
-    if(ep.ep_tmEmitted<0) continue;
-    FLOAT3D vPos=Lerp(ep.ep_vLastPos, ep.ep_vPos, fLerpFactor);
-    FLOAT fRot=Lerp(ep.ep_fLastRot, ep.ep_fRot, fLerpFactor);
+    if(tmEmitted<0) continue;
+    FLOAT3D vPos=Lerp(em.em_avLastPos[i], em.em_avPos[i], fLerpFactor);
+    FLOAT fRot=Lerp(em.em_afLastRot[i], em.em_afRot[i], fLerpFactor);
     //COLOR col=LerpColor(ep.ep_colLastColor, ep.ep_colColor, fLerpFactor);
     
     COLOR col = pTD->GetTexel(PIX((afStarsPositions[iRnd][2]+0.5f)*1024.0f), 0);
@@ -5543,7 +5719,7 @@ void Particles_AirElementalBlow(CEmiter &em)
     UBYTE ubA=UBYTE((colA&0xFF)*0.75f);
     COLOR colCombined=(col&0xFFFFFF00)|ubA;
 
-    Particle_RenderSquare( vPos, (1.5f+1.5f*fRatio)*ep.ep_fStretch, fRot, colCombined);
+    Particle_RenderSquare( vPos, (1.5f+1.5f*fRatio)*em.em_afStretch[i], fRot, colCombined);
   }
   // all done
   Particle_Flush();
@@ -6029,15 +6205,16 @@ void Particles_Fireworks01(CEmiter &em)
   ULONG *pcol=pTD->GetRowPointer(em.em_iGlobal);
 
   FLOAT fLerpFactor=_pTimer->GetLerpFactor();
-  for(INDEX i=0; i<em.em_aepParticles.Count(); i++)
+  for(INDEX i=0; i<em.Count(); i++)
   {
-    const CEmittedParticle &ep=em.em_aepParticles[i];
-    if(ep.ep_tmEmitted<0) continue;
-    FLOAT3D vPos=Lerp(ep.ep_vLastPos, ep.ep_vPos, fLerpFactor);
-    FLOAT fRot=Lerp(ep.ep_fLastRot, ep.ep_fRot, fLerpFactor);
-    INDEX iIndex=INDEX((tmNow-ep.ep_tmEmitted)*2.0f/(ep.ep_tmLife)*255.0f)%255;
-    COLOR col=MulColors(ByteSwap(pcol[iIndex]), MulColors(ep.ep_colColor, em.em_colGlobal));
-    Particle_RenderSquare( vPos, ep.ep_fStretch, fRot, col);
+    // [Cecil] Separate particle fields
+    const FLOAT tmEmitted=em.em_atmEmitted[i];
+    if(tmEmitted<0) continue;
+    FLOAT3D vPos=Lerp(em.em_avLastPos[i], em.em_avPos[i], fLerpFactor);
+    FLOAT fRot=Lerp(em.em_afLastRot[i], em.em_afRot[i], fLerpFactor);
+    INDEX iIndex=INDEX((tmNow-tmEmitted)*2.0f/(em.em_atmLife[i])*255.0f)%255;
+    COLOR col=MulColors(ByteSwap(pcol[iIndex]), MulColors(em.em_acolColor[i], em.em_colGlobal));
+    Particle_RenderSquare( vPos, em.em_afStretch[i], fRot, col);
   }
   // all done
   Particle_Flush();
@@ -108,11 +108,25 @@ public:
   INDEX   iGridSide;
   FLOAT   fStep;
   CListNode cgc_Node;
-  CStaticStackArray<CGrowth> acgParticles;
+  CStaticStackArray<CGrowth> acgParticles; // [Cecil] Grid of cells that wraps around absolute cell positions
+
+  // [Cecil] 2026-10-19: For incremental rebuilding
+  BOOL bValid;
+  INDEX iCellX0; // first absolute cell in the grid
+  INDEX iCellZ0;
+  CTextureData *ptdMap;
+  FLOATaabbox3D boxMap;
+
+  // [Cecil] Constructor
+  CGrowthCache(void) : ulID(0), vLastPos(0, 0, 0), iGridSide(0), fStep(0), bValid(FALSE),
+    iCellX0(0), iCellZ0(0), ptdMap(NULL) {};
 };
 
 void DECL_DLL Particles_Growth(CEntity *pen, CTextureData *ptdGrowthMap, FLOATaabbox3D &boxGrowthMap, CEntity *penEPH, INDEX iDrawPort);
 
+// [Cecil] 2026-10-19: Measure growth cache rebuilding along a camera path
+void DECL_DLL CECIL_GrowthBenchmark(INDEX ctSteps);
+
 void DECL_DLL Particles_Rain( CEntity *pen, FLOAT fGridSize, INDEX ctGrids, FLOAT fFactor, 
                     CTextureData *ptdRainMap, FLOATaabbox3D &boxRainMap);
 void DECL_DLL Particles_Snow( CEntity *pen, FLOAT fGridSize, INDEX ctGrids, FLOAT fPower,
@@ -5,9 +5,12 @@
 #define PRINTOUT(_dummy)
 //#define PRINTOUT(something) something
 
-// open and closed lists of nodes
-static CListHead _lhOpen;
-static CListHead _lhClosed;
+// [Cecil] 2026-10-19: Open set as a binary heap that keeps its memory between searches
+static CStaticStackArray<CPathNode *> _appnOpen;
+
+// [Cecil] 2026-10-19: Current search and order of nodes added to the open heap in it
+static ULONG _ulPathSearch = 0;
+static ULONG _ulOpenOrder = 0;
 
 FLOAT NodeDistance(CPathNode *ppn0, CPathNode *ppn1)
 {
@@ -19,6 +22,10 @@ FLOAT NodeDistance(CPathNode *ppn0, CPathNode *ppn1)
 CPathNode::CPathNode(class CNavigationMarker *penMarker)
 {
   pn_pnmMarker = penMarker;
+  pn_ulSearch = 0;
+  pn_iOpen = -1;
+  pn_bClosed = FALSE;
+  pn_ulOrder = 0;
   pn_ppnParent = NULL;
   pn_fG = 0.0f;
   pn_fH = 0.0f;
@@ -28,8 +35,10 @@ CPathNode::CPathNode(class CNavigationMarker *penMarker)
 CPathNode::~CPathNode(void)
 {
   // detach from marker when deleting
-  ASSERT(pn_pnmMarker!=NULL);
-  pn_pnmMarker->m_ppnNode = NULL;
+  // [Cecil] 2026-10-19: Benchmark nodes have no markers
+  if (pn_pnmMarker!=NULL) {
+    pn_pnmMarker->m_ppnNode = NULL;
+  }
 }
 
 // get name of this node
@@ -57,56 +66,146 @@ CPathNode *CPathNode::GetLink(INDEX i)
   return pnm->GetPathNode();
 }
 
-// add given node to open list, sorting best first
-static void SortIntoOpenList(CPathNode *ppnLink)
+// [Cecil] 2026-10-19: Reset node state left from some previous search
+static inline void TouchNode(CPathNode *ppn)
 {
-  // start at head of the open list
-  LISTITER(CPathNode, pn_lnInOpen) itpn(_lhOpen);
-  // while the given node is further than the one in list
-  while(ppnLink->pn_fF>itpn->pn_fF && !itpn.IsPastEnd()) {
-    // move to next node
-    itpn.MoveToNext();
+  if (ppn->pn_ulSearch==_ulPathSearch) {
+    return;
   }
 
-  // if past the end of list
-  if (itpn.IsPastEnd()) {
-    // add to the end of list
-    _lhOpen.AddTail(ppnLink->pn_lnInOpen);
-  // if not past end of list
-  } else {
-    // add before current node
-    itpn.InsertBeforeCurrent(ppnLink->pn_lnInOpen);
+  ppn->pn_ulSearch = _ulPathSearch;
+  ppn->pn_iOpen = -1;
+  ppn->pn_bClosed = FALSE;
+  ppn->pn_ppnParent = NULL;
+  ppn->pn_fG = 0.0f;
+  ppn->pn_fH = 0.0f;
+  ppn->pn_fF = 0.0f;
+}
+
+// [Cecil] 2026-10-19: Check if one node should be expanded before the other
+static inline BOOL OpenBefore(const CPathNode *ppn0, const CPathNode *ppn1)
+{
+  if (ppn0->pn_fF!=ppn1->pn_fF) {
+    return ppn0->pn_fF<ppn1->pn_fF;
   }
+  // nodes added later go first, like they did in the old sorted open list
+  return ppn0->pn_ulOrder>ppn1->pn_ulOrder;
 }
-  
-// find shortest path from one marker to another
-static BOOL FindPath(CNavigationMarker *pnmSrc, CNavigationMarker *pnmDst)
+
+// [Cecil] 2026-10-19: Put node in its heap slot
+static inline void SetOpenSlot(INDEX i, CPathNode *ppn)
 {
+  _appnOpen[i] = ppn;
+  ppn->pn_iOpen = i;
+}
 
-  ASSERT(pnmSrc!=pnmDst);
-  CPathNode *ppnSrc = pnmSrc->GetPathNode();
-  CPathNode *ppnDst = pnmDst->GetPathNode();
+// [Cecil] 2026-10-19: Move node up the heap until it's in order
+static void OpenSiftUp(INDEX i)
+{
+  CPathNode *ppn = _appnOpen[i];
+
+  while (i>0) {
+    INDEX iParent = (i-1)/2;
+    if (!OpenBefore(ppn, _appnOpen[iParent])) {
+      break;
+    }
+    SetOpenSlot(i, _appnOpen[iParent]);
+    i = iParent;
+  }
+  SetOpenSlot(i, ppn);
+}
+
+// [Cecil] 2026-10-19: Move node down the heap until it's in order
+static void OpenSiftDown(INDEX i)
+{
+  const INDEX ct = _appnOpen.Count();
+  CPathNode *ppn = _appnOpen[i];
+
+  for (;;) {
+    INDEX iChild = i*2+1;
+    if (iChild>=ct) {
+      break;
+    }
+    // pick the better child
+    if (iChild+1<ct && OpenBefore(_appnOpen[iChild+1], _appnOpen[iChild])) {
+      iChild++;
+    }
+    if (!OpenBefore(_appnOpen[iChild], ppn)) {
+      break;
+    }
+    SetOpenSlot(i, _appnOpen[iChild]);
+    i = iChild;
+  }
+  SetOpenSlot(i, ppn);
+}
+
+// add given node to open heap
+static void AddToOpen(CPathNode *ppn)
+{
+  ASSERT(ppn->pn_iOpen<0);
+  ppn->pn_ulOrder = _ulOpenOrder++;
+  _appnOpen.Push() = ppn;
+  OpenSiftUp(_appnOpen.Count()-1);
+}
+
+// remove the best node from the open heap
+static CPathNode *RemoveFromOpen(void)
+{
+  CPathNode *ppnBest = _appnOpen[0];
+  CPathNode *ppnLast = _appnOpen.Pop();
+
+  if (ppnLast!=ppnBest) {
+    SetOpenSlot(0, ppnLast);
+    OpenSiftDown(0);
+  }
+
+  ppnBest->pn_iOpen = -1;
+  return ppnBest;
+}
+
+// [Cecil] 2026-10-19: Graph of navigation markers in the world
+class CMarkerGraph {
+public:
+  inline FLOAT Distance(CPathNode *ppn0, CPathNode *ppn1) const {
+    return NodeDistance(ppn0, ppn1);
+  };
+
+  inline CPathNode *Link(CPathNode *ppn, INDEX i) const {
+    return ppn->GetLink(i);
+  };
+};
+
+// find shortest path from one node to another
+// [Cecil] 2026-10-19: Uses a binary heap and doesn't allocate nodes
+template<class Graph>
+static BOOL FindPath(const Graph &g, CPathNode *ppnSrc, CPathNode *ppnDst)
+{
+  ASSERT(ppnSrc!=ppnDst);
 
   PRINTOUT(CPrintF("--------------------\n"));
   PRINTOUT(CPrintF("FindPath(%s, %s)\n", ppnSrc->GetName(), ppnDst->GetName()));
 
-  // start with empty open and closed lists
-  ASSERT(_lhOpen.IsEmpty());
-  ASSERT(_lhClosed.IsEmpty());
+  // start a new search, which invalidates states of all nodes
+  _ulPathSearch++;
+  if (_ulPathSearch==0) {
+    _ulPathSearch++;
+  }
+  _ulOpenOrder = 0;
+  _appnOpen.PopAll();
 
-  // add the start node to open list
+  // add the start node to open heap
+  TouchNode(ppnSrc);
   ppnSrc->pn_fG = 0.0f;
-  ppnSrc->pn_fH = NodeDistance(ppnSrc, ppnDst);
+  ppnSrc->pn_fH = g.Distance(ppnSrc, ppnDst);
   ppnSrc->pn_fF = ppnSrc->pn_fG +ppnSrc->pn_fH;
-  _lhOpen.AddTail(ppnSrc->pn_lnInOpen);
+  AddToOpen(ppnSrc);
   PRINTOUT(CPrintF("StartState: %s\n", ppnSrc->GetName()));
 
-  // while the open list is not empty
-  while (!_lhOpen.IsEmpty()) {
-    // get the first node from open list (that is, the one with lowest F)
-    CPathNode *ppnNode = LIST_HEAD(_lhOpen, CPathNode, pn_lnInOpen);
-    ppnNode->pn_lnInOpen.Remove();
-      _lhClosed.AddTail(ppnNode->pn_lnInClosed);
+  // while the open heap is not empty
+  while (_appnOpen.Count()>0) {
+    // get the node with lowest F
+    CPathNode *ppnNode = RemoveFromOpen();
+    ppnNode->pn_bClosed = TRUE;
     PRINTOUT(CPrintF("Node: %s - moved from OPEN to CLOSED\n", ppnNode->GetName()));
 
     // if this is the goal
@@ -118,12 +217,18 @@ static BOOL FindPath(CNavigationMarker *pnmSrc, CNavigationMarker *pnmDst)
 
     // for each link of current node
     CPathNode *ppnLink = NULL;
-    for(INDEX i=0; (ppnLink=ppnNode->GetLink(i))!=NULL; i++) {
+    for(INDEX i=0; (ppnLink=g.Link(ppnNode, i))!=NULL; i++) {
       PRINTOUT(CPrintF(" Link %d: %s\n", i, ppnLink->GetName()));
+      TouchNode(ppnLink);
+
       // get cost to get to this node if coming from current node
-      FLOAT fNewG = ppnLink->pn_fG+NodeDistance(ppnNode, ppnLink);
+      // [Cecil] 2026-10-19: NOTE: This is the old formula, which adds the link's own cost and not the current node's,
+      // so the new cost is never lower for nodes that are already open or closed and they are always skipped.
+      // Nodes in the open heap never change their cost, which is why it pops them in exactly the same order
+      // as the old sorted list that never re-sorted its nodes.
+      FLOAT fNewG = ppnLink->pn_fG+g.Distance(ppnNode, ppnLink);
       // if a shorter path already exists
-      if ((ppnLink->pn_lnInOpen.IsLinked() || ppnLink->pn_lnInClosed.IsLinked()) && fNewG>=ppnLink->pn_fG) {
+      if ((ppnLink->pn_iOpen>=0 || ppnLink->pn_bClosed) && fNewG>=ppnLink->pn_fG) {
         PRINTOUT(CPrintF("  shorter path exists through: %s\n", ppnLink->pn_ppnParent->GetName()));
         // skip this link
         continue;
@@ -131,16 +236,18 @@ static BOOL FindPath(CNavigationMarker *pnmSrc, CNavigationMarker *pnmDst)
       // remember this path
       ppnLink->pn_ppnParent = ppnNode;
       ppnLink->pn_fG = fNewG;
-      ppnLink->pn_fH = NodeDistance(ppnLink, ppnDst);
+      ppnLink->pn_fH = g.Distance(ppnLink, ppnDst);
       ppnLink->pn_fF = ppnLink->pn_fG + ppnLink->pn_fH;
       // remove from closed list, if in it
-      if (ppnLink->pn_lnInClosed.IsLinked()) {
-        ppnLink->pn_lnInClosed.Remove();
+      if (ppnLink->pn_bClosed) {
+        ppnLink->pn_bClosed = FALSE;
         PRINTOUT(CPrintF("  %s removed from CLOSED\n", ppnLink->GetName()));
       }
       // add to open if not in it
-      if (!ppnLink->pn_lnInOpen.IsLinked()) {
-        SortIntoOpenList(ppnLink);
+      // [Cecil] 2026-10-19: Open nodes aren't moved, like in the old list (see above)
+      ASSERT(ppnLink->pn_iOpen<0);
+      if (ppnLink->pn_iOpen<0) {
+        AddToOpen(ppnLink);
         PRINTOUT(CPrintF("  %s added to OPEN\n", ppnLink->GetName()));
       }
     }
@@ -151,52 +258,295 @@ static BOOL FindPath(CNavigationMarker *pnmSrc, CNavigationMarker *pnmDst)
   return FALSE;
 }
 
-// clear all temporary structures used for path finding
-static void ClearPath(CEntity *penThis)
+// [Cecil] 2026-10-19: Spatial index of navigation markers
+
+// Marker in some sector
+struct SMarkerEntry {
+  CBrushSector *me_pbsc;
+  ULONG me_ulBrushID; // entity ID of the sector's brush
+  INDEX me_iSector; // sector index in its brush mip
+  CNavigationMarker *me_pnm;
+  FLOAT3D me_vPos;
+  INDEX me_iAxis; // splitting axis of this k-d tree node
+  INDEX me_iOrder; // position in the sector's entity list, for picking between equally close markers
+};
+
+// Markers of one sector as an implicit k-d tree
+struct SSectorMarkers {
+  CBrushSector *sm_pbsc;
+  INDEX sm_iFirst;
+  INDEX sm_ct;
+};
+
+static CStaticStackArray<SMarkerEntry> _ameMarkers; // grouped by sectors
+static CStaticStackArray<SSectorMarkers> _asmSectors; // in the same order as markers
+static CStaticStackArray<INDEX> _aiSectorLookup; // sector groups sorted by sectors, only for finding them
+static CDynamicContainer<CNavigationMarker> _cMovingMarkers; // markers with parents aren't indexed
+
+static CWorld *_pwoMarkerIndex = NULL;
+static ULONG _ulMarkerIndexRevision = 0;
+static ULONG _ulMarkerRevision = 1;
+
+// markers have been created or destroyed
+void PATH_MarkersChanged(void)
 {
-  {FORDELETELIST(CPathNode, pn_lnInOpen, _lhOpen, itpn) {
-    delete &itpn.Current();
-  }}
-  {FORDELETELIST(CPathNode, pn_lnInClosed, _lhClosed, itpn) {
-    delete &itpn.Current();          
-  }}
+  _ulMarkerRevision++;
+}
+
+// sort markers by their sectors and IDs, which doesn't depend on where anything is in memory
+static int qsort_CompareMarkerSectors(const void *pv0, const void *pv1)
+{
+  const SMarkerEntry &me0 = *(const SMarkerEntry *)pv0;
+  const SMarkerEntry &me1 = *(const SMarkerEntry *)pv1;
+
+  if (me0.me_ulBrushID<me1.me_ulBrushID) return -1;
+  if (me0.me_ulBrushID>me1.me_ulBrushID) return +1;
+  if (me0.me_iSector<me1.me_iSector) return -1;
+  if (me0.me_iSector>me1.me_iSector) return +1;
+  if (me0.me_pnm->en_ulID<me1.me_pnm->en_ulID) return -1;
+  if (me0.me_pnm->en_ulID>me1.me_pnm->en_ulID) return +1;
+  return 0;
+}
+
+static int qsort_CompareSectorLookup(const void *pv0, const void *pv1)
+{
+  const CBrushSector *pbsc0 = _asmSectors[*(const INDEX *)pv0].sm_pbsc;
+  const CBrushSector *pbsc1 = _asmSectors[*(const INDEX *)pv1].sm_pbsc;
+
+  if (pbsc0<pbsc1) return -1;
+  if (pbsc0>pbsc1) return +1;
+  return 0;
+}
+
+static INDEX _iMarkerSortAxis = 1;
+
+static int qsort_CompareMarkerAxis(const void *pv0, const void *pv1)
+{
+  const SMarkerEntry &me0 = *(const SMarkerEntry *)pv0;
+  const SMarkerEntry &me1 = *(const SMarkerEntry *)pv1;
+
+  if (me0.me_vPos(_iMarkerSortAxis)<me1.me_vPos(_iMarkerSortAxis)) return -1;
+  if (me0.me_vPos(_iMarkerSortAxis)>me1.me_vPos(_iMarkerSortAxis)) return +1;
+  if (me0.me_pnm->en_ulID<me1.me_pnm->en_ulID) return -1;
+  if (me0.me_pnm->en_ulID>me1.me_pnm->en_ulID) return +1;
+  return 0;
+}
+
+// build k-d tree out of markers in a range
+static void BuildMarkerTree(INDEX iFirst, INDEX iLast)
+{
+  if (iFirst>=iLast) {
+    return;
+  }
+
+  // split along the longest side
+  FLOATaabbox3D box;
+  INDEX i;
+  for (i=iFirst; i<iLast; i++) {
+    box |= _ameMarkers[i].me_vPos;
+  }
+
+  const FLOAT3D vSize = box.Size();
+  _iMarkerSortAxis = 1;
+  if (vSize(2)>vSize(_iMarkerSortAxis)) _iMarkerSortAxis = 2;
+  if (vSize(3)>vSize(_iMarkerSortAxis)) _iMarkerSortAxis = 3;
+
+  qsort(&_ameMarkers[iFirst], iLast-iFirst, sizeof(SMarkerEntry), qsort_CompareMarkerAxis);
+
+  const INDEX iMiddle = (iFirst+iLast)/2;
+  _ameMarkers[iMiddle].me_iAxis = _iMarkerSortAxis;
+
+  BuildMarkerTree(iFirst, iMiddle);
+  BuildMarkerTree(iMiddle+1, iLast);
+}
+
+// collect all markers in the world, if they have changed
+static void UpdateMarkerIndex(CWorld *pwo)
+{
+  if (_pwoMarkerIndex==pwo && _ulMarkerIndexRevision==_ulMarkerRevision) {
+    return;
+  }
+
+  _pwoMarkerIndex = pwo;
+  _ulMarkerIndexRevision = _ulMarkerRevision;
+
+  _ameMarkers.PopAll();
+  _asmSectors.PopAll();
+  _aiSectorLookup.PopAll();
+  _cMovingMarkers.Clear();
 
-#ifndef NDEBUG
   // for each navigation marker in the world
-  {FOREACHINDYNAMICCONTAINER(penThis->en_pwoWorld->wo_cenEntities, CEntity, iten) {
+  {FOREACHINDYNAMICCONTAINER(pwo->wo_cenEntities, CEntity, iten) {
     if (!IsOfClass(iten, "NavigationMarker")) {
       continue;
     }
-    CNavigationMarker &nm = (CNavigationMarker&)*iten;
-    ASSERT(nm.m_ppnNode==NULL);
+    CNavigationMarker *pnm = (CNavigationMarker *)&*iten;
+
+    // can be moved by its parent
+    if (pnm->GetParent()!=NULL) {
+      _cMovingMarkers.Add(pnm);
+      continue;
+    }
+
+    // add to each sector it's in
+    {FOREACHSRCOFDST(pnm->en_rdSectors, CBrushSector, bsc_rsEntities, pbsc)
+      SMarkerEntry &me = _ameMarkers.Push();
+      me.me_pbsc = pbsc;
+      me.me_ulBrushID = pbsc->bsc_pbmBrushMip->bm_pbrBrush->br_penEntity->en_ulID;
+      me.me_iSector = pbsc->bsc_pbmBrushMip->bm_abscSectors.Index(pbsc);
+      me.me_pnm = pnm;
+      me.me_vPos = pnm->GetPlacement().pl_PositionVector;
+      me.me_iAxis = 1;
+      me.me_iOrder = 0;
+    ENDFOR}
+  }}
+
+  const INDEX ctEntries = _ameMarkers.Count();
+  if (ctEntries==0) {
+    return;
+  }
+
+  // group markers by sectors
+  qsort(&_ameMarkers[0], ctEntries, sizeof(SMarkerEntry), qsort_CompareMarkerSectors);
+
+  for (INDEX i=0; i<ctEntries; i++) {
+    if (i==0 || _ameMarkers[i].me_pbsc!=_ameMarkers[i-1].me_pbsc) {
+      SSectorMarkers &sm = _asmSectors.Push();
+      sm.sm_pbsc = _ameMarkers[i].me_pbsc;
+      sm.sm_iFirst = i;
+      sm.sm_ct = 0;
+    }
+    _asmSectors[_asmSectors.Count()-1].sm_ct++;
+  }
+
+  // sector lookup only finds the one group of each sector, so its order doesn't matter for results
+  for (INDEX iLookup=0; iLookup<_asmSectors.Count(); iLookup++) {
+    _aiSectorLookup.Push() = iLookup;
+  }
+  qsort(&_aiSectorLookup[0], _aiSectorLookup.Count(), sizeof(INDEX), qsort_CompareSectorLookup);
+
+  for (INDEX iSector=0; iSector<_asmSectors.Count(); iSector++) {
+    const SSectorMarkers &sm = _asmSectors[iSector];
+
+    // remember the order in which walking through the sector would find markers
+    INDEX iOrder = 0;
+    {FOREACHDSTOFSRC(sm.sm_pbsc->bsc_rsEntities, CEntity, en_rdSectors, pen)
+      for (INDEX iEntry=sm.sm_iFirst; iEntry<sm.sm_iFirst+sm.sm_ct; iEntry++) {
+        if (_ameMarkers[iEntry].me_pnm==pen) {
+          _ameMarkers[iEntry].me_iOrder = iOrder;
+          break;
+        }
+      }
+      iOrder++;
+    ENDFOR}
+
+    BuildMarkerTree(sm.sm_iFirst, sm.sm_iFirst+sm.sm_ct);
+  }
+}
+
+// find markers of some sector
+static const SSectorMarkers *FindSectorMarkers(CBrushSector *pbsc)
+{
+  INDEX iMin = 0;
+  INDEX iMax = _aiSectorLookup.Count()-1;
+
+  while (iMin<=iMax) {
+    const INDEX iMiddle = (iMin+iMax)/2;
+    const SSectorMarkers &sm = _asmSectors[_aiSectorLookup[iMiddle]];
+
+    if (sm.sm_pbsc==pbsc) {
+      return &sm;
+    } else if (sm.sm_pbsc<pbsc) {
+      iMin = iMiddle+1;
+    } else {
+      iMax = iMiddle-1;
+    }
+  }
+  return NULL;
+}
+
+// find the closest marker in a k-d tree of one sector
+// (between equally close markers, the one that comes first in the sector wins, but not over markers of previous sectors)
+static void FindClosestInTree(INDEX iFirst, INDEX iLast, const FLOAT3D &vSrc, CNavigationMarker *&pnmMin, FLOAT &fMinDist, INDEX &iMinOrder)
+{
+  if (iFirst>=iLast) {
+    return;
+  }
+
+  const INDEX iMiddle = (iFirst+iLast)/2;
+  const SMarkerEntry &me = _ameMarkers[iMiddle];
+
+  // get distance from source
+  FLOAT fDist = (vSrc-me.me_vPos).Length();
+  // if closer than best found, or found earlier in the same sector
+  if (fDist<fMinDist || (fDist==fMinDist && iMinOrder!=-1 && me.me_iOrder<iMinOrder)) {
+    // remember it
+    fMinDist = fDist;
+    pnmMin = me.me_pnm;
+    iMinOrder = me.me_iOrder;
+  }
+
+  // search the near side first and the far side only if it can be closer
+  const FLOAT fPlane = vSrc(me.me_iAxis)-me.me_vPos(me.me_iAxis);
+
+  if (fPlane<0.0f) {
+    FindClosestInTree(iFirst, iMiddle, vSrc, pnmMin, fMinDist, iMinOrder);
+    if (-fPlane<=fMinDist) {
+      FindClosestInTree(iMiddle+1, iLast, vSrc, pnmMin, fMinDist, iMinOrder);
+    }
+  } else {
+    FindClosestInTree(iMiddle+1, iLast, vSrc, pnmMin, fMinDist, iMinOrder);
+    if (fPlane<=fMinDist) {
+      FindClosestInTree(iFirst, iMiddle, vSrc, pnmMin, fMinDist, iMinOrder);
+    }
+  }
+}
+
+// check if any marker that can move is in some sector
+static BOOL HasMovingMarkers(CBrushSector *pbsc)
+{
+  {FOREACHINDYNAMICCONTAINER(_cMovingMarkers, CNavigationMarker, itnm) {
+    {FOREACHSRCOFDST(itnm->en_rdSectors, CBrushSector, bsc_rsEntities, pbscMarker)
+      if (pbsc==pbscMarker) {
+        return TRUE;
+      }
+    ENDFOR}
   }}
-#endif
+  return FALSE;
 }
 
 // find marker closest to a given position
+// [Cecil] 2026-10-19: Only markers in sectors of this entity, like before, but without walking through other entities
 static void FindClosestMarker(
     CEntity *penThis, const FLOAT3D &vSrc, CEntity *&penMarker, FLOAT3D &vPath)
 {
+  UpdateMarkerIndex(penThis->en_pwoWorld);
+
   CNavigationMarker *pnmMin = NULL;
   FLOAT fMinDist = UpperLimit(0.0f);
   // for each sector this entity is in
   {FOREACHSRCOFDST(penThis->en_rdSectors, CBrushSector, bsc_rsEntities, pbsc)
-    // for each navigation marker in that sector
-    {FOREACHDSTOFSRC(pbsc->bsc_rsEntities, CEntity, en_rdSectors, pen)
-      if (!IsOfClass(pen, "NavigationMarker")) {
-        continue;
-      }
-      CNavigationMarker &nm = (CNavigationMarker&)*pen;
+    // markers that can move aren't indexed, so walk through the sector like before
+    if (HasMovingMarkers(pbsc)) {
+      {FOREACHDSTOFSRC(pbsc->bsc_rsEntities, CEntity, en_rdSectors, pen)
+        if (!IsOfClass(pen, "NavigationMarker")) {
+          continue;
+        }
+        FLOAT fDist = (vSrc-pen->GetPlacement().pl_PositionVector).Length();
+        if (fDist<fMinDist) {
+          fMinDist = fDist;
+          pnmMin = (CNavigationMarker *)pen;
+        }
+      ENDFOR}
 
-      // get distance from source
-      FLOAT fDist = (vSrc-nm.GetPlacement().pl_PositionVector).Length();
-      // if closer than best found
-      if(fDist<fMinDist) {
-        // remember it
-        fMinDist = fDist;
-        pnmMin = &nm;
+    // check navigation markers in that sector
+    } else {
+      const SSectorMarkers *psm = FindSectorMarkers(pbsc);
+      if (psm!=NULL) {
+        INDEX iMinOrder = -1;
+        FindClosestInTree(psm->sm_iFirst, psm->sm_iFirst+psm->sm_ct, vSrc, pnmMin, fMinDist, iMinOrder);
       }
-    ENDFOR}
+    }
   ENDFOR}
 
   // if none found
@@ -253,13 +603,12 @@ void PATH_FindNextMarker(CEntity *penThis, const FLOAT3D &vSrc, const FLOAT3D &v
   }
 
   // try to find shortest path to the destination
-  BOOL bFound = FindPath((CNavigationMarker*)penMarker, pnmDst);
+  CPathNode *ppnSrc = ((CNavigationMarker*)penMarker)->GetPathNode();
+  BOOL bFound = FindPath(CMarkerGraph(), ppnSrc, pnmDst->GetPathNode());
 
   // if not found
   if (!bFound) {
-    // just clean up and fail
-    delete pnmDst->GetPathNode();
-    ClearPath(penThis);
+    // fail
     penMarker = NULL;
     vPath = vSrc;
     return;
@@ -274,7 +623,458 @@ void PATH_FindNextMarker(CEntity *penThis, const FLOAT3D &vSrc, const FLOAT3D &v
 
   // go there
   vPath = penMarker->GetPlacement().pl_PositionVector;
+}
+// [Cecil] 2026-10-19: Path finding benchmark
 
-  // clean up
-  ClearPath(penThis);
-}
\ No newline at end of file
+#define BENCH_LINKS 6 // same as marker targets
+
+// Synthetic marker
+struct SBenchNode {
+  CPathNode bn_pn; // must be first
+  FLOAT3D bn_vPos;
+  INDEX bn_aiLinks[BENCH_LINKS]; // -1 terminated, like marker targets
+
+  SBenchNode(void) : bn_pn(NULL) {};
+};
+
+// Graph of synthetic markers
+class CBenchGraph {
+public:
+  CStaticArray<SBenchNode> &bg_aNodes;
+
+  CBenchGraph(CStaticArray<SBenchNode> &aNodes) : bg_aNodes(aNodes) {};
+
+  inline INDEX Index(CPathNode *ppn) const {
+    return (SBenchNode *)ppn - &bg_aNodes[0];
+  };
+
+  inline FLOAT Distance(INDEX i0, INDEX i1) const {
+    return (bg_aNodes[i0].bn_vPos - bg_aNodes[i1].bn_vPos).Length();
+  };
+
+  inline FLOAT Distance(CPathNode *ppn0, CPathNode *ppn1) const {
+    return Distance(Index(ppn0), Index(ppn1));
+  };
+
+  inline INDEX LinkIndex(INDEX iNode, INDEX i) const {
+    return (i<BENCH_LINKS ? bg_aNodes[iNode].bn_aiLinks[i] : -1);
+  };
+
+  inline CPathNode *Link(CPathNode *ppn, INDEX i) const {
+    INDEX iLink = LinkIndex(Index(ppn), i);
+    return (iLink<0 ? NULL : &bg_aNodes[iLink].bn_pn);
+  };
+};
+
+// Node of the old search (old CPathNode)
+struct SRefNode {
+  INDEX rn_iNode;
+  CListNode rn_lnInOpen;
+  CListNode rn_lnInClosed;
+  SRefNode *rn_prnParent;
+  FLOAT rn_fG;
+  FLOAT rn_fH;
+  FLOAT rn_fF;
+
+  SRefNode(INDEX iNode) : rn_iNode(iNode), rn_prnParent(NULL), rn_fG(0.0f), rn_fH(0.0f), rn_fF(0.0f) {};
+};
+
+// Old open and closed lists
+static CListHead _lhRefOpen;
+static CListHead _lhRefClosed;
+
+// Old nodes created on demand for each marker (old CNavigationMarker::GetPathNode)
+static CStaticArray<SRefNode *> _aprnRefNodes;
+
+static SRefNode *RefNode(INDEX iNode)
+{
+  if (_aprnRefNodes[iNode]==NULL) {
+    _aprnRefNodes[iNode] = new SRefNode(iNode);
+  }
+  return _aprnRefNodes[iNode];
+}
+
+static FLOAT RefDistance(const CBenchGraph &g, SRefNode *prn0, SRefNode *prn1)
+{
+  return g.Distance(prn0->rn_iNode, prn1->rn_iNode);
+}
+
+// Old SortIntoOpenList() without changes
+static void RefSortIntoOpenList(SRefNode *ppnLink)
+{
+  // start at head of the open list
+  LISTITER(SRefNode, rn_lnInOpen) itpn(_lhRefOpen);
+  // while the given node is further than the one in list
+  while(ppnLink->rn_fF>itpn->rn_fF && !itpn.IsPastEnd()) {
+    // move to next node
+    itpn.MoveToNext();
+  }
+
+  // if past the end of list
+  if (itpn.IsPastEnd()) {
+    // add to the end of list
+    _lhRefOpen.AddTail(ppnLink->rn_lnInOpen);
+  // if not past end of list
+  } else {
+    // add before current node
+    itpn.InsertBeforeCurrent(ppnLink->rn_lnInOpen);
+  }
+}
+
+// Old FindPath() without changes
+static BOOL RefFindPath(const CBenchGraph &g, INDEX iSrc, INDEX iDst)
+{
+  ASSERT(iSrc!=iDst);
+  SRefNode *ppnSrc = RefNode(iSrc);
+  SRefNode *ppnDst = RefNode(iDst);
+
+  // start with empty open and closed lists
+  ASSERT(_lhRefOpen.IsEmpty());
+  ASSERT(_lhRefClosed.IsEmpty());
+
+  // add the start node to open list
+  ppnSrc->rn_fG = 0.0f;
+  ppnSrc->rn_fH = RefDistance(g, ppnSrc, ppnDst);
+  ppnSrc->rn_fF = ppnSrc->rn_fG +ppnSrc->rn_fH;
+  _lhRefOpen.AddTail(ppnSrc->rn_lnInOpen);
+
+  // while the open list is not empty
+  while (!_lhRefOpen.IsEmpty()) {
+    // get the first node from open list (that is, the one with lowest F)
+    SRefNode *ppnNode = LIST_HEAD(_lhRefOpen, SRefNode, rn_lnInOpen);
+    ppnNode->rn_lnInOpen.Remove();
+      _lhRefClosed.AddTail(ppnNode->rn_lnInClosed);
+
+    // if this is the goal
+    if (ppnNode==ppnDst) {
+      // the path is found
+      return TRUE;
+    }
+
+    // for each link of current node
+    INDEX iLink;
+    for(INDEX i=0; (iLink=g.LinkIndex(ppnNode->rn_iNode, i))>=0; i++) {
+      SRefNode *ppnLink = RefNode(iLink);
+      // get cost to get to this node if coming from current node
+      FLOAT fNewG = ppnLink->rn_fG+RefDistance(g, ppnNode, ppnLink);
+      // if a shorter path already exists
+      if ((ppnLink->rn_lnInOpen.IsLinked() || ppnLink->rn_lnInClosed.IsLinked()) && fNewG>=ppnLink->rn_fG) {
+        // skip this link
+        continue;
+      }
+      // remember this path
+      ppnLink->rn_prnParent = ppnNode;
+      ppnLink->rn_fG = fNewG;
+      ppnLink->rn_fH = RefDistance(g, ppnLink, ppnDst);
+      ppnLink->rn_fF = ppnLink->rn_fG + ppnLink->rn_fH;
+      // remove from closed list, if in it
+      if (ppnLink->rn_lnInClosed.IsLinked()) {
+        ppnLink->rn_lnInClosed.Remove();
+      }
+      // add to open if not in it
+      if (!ppnLink->rn_lnInOpen.IsLinked()) {
+        RefSortIntoOpenList(ppnLink);
+      }
+    }
+  }
+
+  // if we get here, there is no path
+  return FALSE;
+}
+
+// Old ClearPath() that also remembers parents of all nodes before deleting them
+static void RefClearPath(CStaticArray<INDEX> &aiParents)
+{
+  for (INDEX iNode=0; iNode<_aprnRefNodes.Count(); iNode++) {
+    SRefNode *prn = _aprnRefNodes[iNode];
+    aiParents[iNode] = (prn!=NULL && prn->rn_prnParent!=NULL ? prn->rn_prnParent->rn_iNode : -1);
+  }
+
+  {FORDELETELIST(SRefNode, rn_lnInOpen, _lhRefOpen, itpn) {
+    _aprnRefNodes[itpn->rn_iNode] = NULL;
+    delete &itpn.Current();
+  }}
+  {FORDELETELIST(SRefNode, rn_lnInClosed, _lhRefClosed, itpn) {
+    _aprnRefNodes[itpn->rn_iNode] = NULL;
+    delete &itpn.Current();
+  }}
+
+  // nodes that have been created but never got into any list
+  for (INDEX iLeft=0; iLeft<_aprnRefNodes.Count(); iLeft++) {
+    if (_aprnRefNodes[iLeft]!=NULL) {
+      delete _aprnRefNodes[iLeft];
+      _aprnRefNodes[iLeft] = NULL;
+    }
+  }
+}
+
+// Simple generator that doesn't touch the game's random seed
+static ULONG _ulBenchSeed = 0;
+
+static INDEX BenchRandom(INDEX ctRange)
+{
+  _ulBenchSeed = _ulBenchSeed*1103515245+12345;
+  return INDEX((_ulBenchSeed>>16)%ULONG(ctRange));
+}
+
+void CECIL_PathBenchmark(INDEX ctQueries)
+{
+  ctQueries = ClampDn(ctQueries, (INDEX)1);
+  _ulBenchSeed = 0x5EED;
+
+  // jittered grid of markers, each linked to some of its neighbours
+  const INDEX iSide = 32;
+  const FLOAT fSpacing = 8.0f;
+  const INDEX ctNodes = iSide*iSide;
+
+  CStaticArray<SBenchNode> aNodes;
+  aNodes.New(ctNodes);
+
+  INDEX iNode;
+  for (iNode=0; iNode<ctNodes; iNode++) {
+    const INDEX iX = iNode%iSide;
+    const INDEX iZ = iNode/iSide;
+    SBenchNode &bn = aNodes[iNode];
+    bn.bn_vPos = FLOAT3D(
+      (iX+BenchRandom(100)*0.004f)*fSpacing,
+      BenchRandom(100)*0.02f,
+      (iZ+BenchRandom(100)*0.004f)*fSpacing);
+
+    INDEX ctLinks = 0;
+    const INDEX ctWanted = 1+BenchRandom(BENCH_LINKS);
+
+    for (INDEX iTry=0; iTry<16 && ctLinks<ctWanted; iTry++) {
+      const INDEX iLinkX = iX+BenchRandom(3)-1;
+      const INDEX iLinkZ = iZ+BenchRandom(3)-1;
+      if (iLinkX<0 || iLinkX>=iSide || iLinkZ<0 || iLinkZ>=iSide) continue;
+
+      const INDEX iLink = iLinkZ*iSide+iLinkX;
+      if (iLink==iNode) continue;
+
+      BOOL bExists = FALSE;
+      for (INDEX iCheck=0; iCheck<ctLinks; iCheck++) {
+        bExists |= (bn.bn_aiLinks[iCheck]==iLink);
+      }
+      if (!bExists) {
+        bn.bn_aiLinks[ctLinks++] = iLink;
+      }
+    }
+
+    for (INDEX iEmpty=ctLinks; iEmpty<BENCH_LINKS; iEmpty++) {
+      bn.bn_aiLinks[iEmpty] = -1;
+    }
+  }
+
+  CBenchGraph g(aNodes);
+
+  // random queries
+  CStaticArray<INDEX> aiQueries;
+  aiQueries.New(ctQueries*2);
+
+  INDEX iQuery;
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    aiQueries[iQuery*2+0] = BenchRandom(ctNodes);
+    do {
+      aiQueries[iQuery*2+1] = BenchRandom(ctNodes);
+    } while (aiQueries[iQuery*2+1]==aiQueries[iQuery*2+0]);
+  }
+
+  CStaticArray<INDEX> aiParents;
+  aiParents.New(ctNodes);
+  _aprnRefNodes.Clear();
+  _aprnRefNodes.New(ctNodes);
+
+  for (iNode=0; iNode<ctNodes; iNode++) {
+    aiParents[iNode] = -1;
+    _aprnRefNodes[iNode] = NULL;
+  }
+
+  // heap search
+  CTimerValue tvStart = _pTimer->GetHighPrecisionTimer();
+
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    FindPath(g, &aNodes[aiQueries[iQuery*2+0]].bn_pn, &aNodes[aiQueries[iQuery*2+1]].bn_pn);
+  }
+
+  const DOUBLE dHeap = (_pTimer->GetHighPrecisionTimer()-tvStart).GetSeconds();
+
+  // old search
+  tvStart = _pTimer->GetHighPrecisionTimer();
+
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    RefFindPath(g, aiQueries[iQuery*2+0], aiQueries[iQuery*2+1]);
+    RefClearPath(aiParents);
+  }
+
+  const DOUBLE dList = (_pTimer->GetHighPrecisionTimer()-tvStart).GetSeconds();
+
+  // compare whole paths from both searches
+  INDEX ctMismatches = 0;
+  INDEX ctFound = 0;
+
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    const INDEX iSrc = aiQueries[iQuery*2+0];
+    const INDEX iDst = aiQueries[iQuery*2+1];
+
+    const BOOL bHeap = FindPath(g, &aNodes[iSrc].bn_pn, &aNodes[iDst].bn_pn);
+    const BOOL bList = RefFindPath(g, iSrc, iDst);
+    RefClearPath(aiParents);
+
+    if (bHeap!=bList) {
+      ctMismatches++;
+      continue;
+    }
+
+    if (!bList) {
+      continue;
+    }
+
+    ctFound++;
+
+    // walk both paths back to the source
+    CPathNode *ppn = &aNodes[iDst].bn_pn;
+    iNode = iDst;
+
+    while (ppn!=NULL && iNode>=0 && g.Index(ppn)==iNode) {
+      ppn = ppn->pn_ppnParent;
+      iNode = aiParents[iNode];
+    }
+
+    if (ppn!=NULL || iNode>=0) {
+      ctMismatches++;
+    }
+  }
+
+  _aprnRefNodes.Clear();
+
+  CPrintF("  Heap search: %.3f ms\n", dHeap*1000.0);
+  CPrintF("  List search: %.3f ms\n", dList*1000.0);
+  CPrintF("Replayed %d queries over %d markers (%d found)\n", ctQueries, ctNodes, ctFound);
+
+  if (ctMismatches==0) {
+    CPrintF("^c00ff00PASS^r: all paths match the old search\n");
+  } else {
+    CPrintF("^cff0000FAIL^r: %d paths differ from the old search\n", ctMismatches);
+  }
+}
+
+// Old closest marker lookup that walks through all entities in sectors
+static CNavigationMarker *ReferenceClosestMarker(CEntity *penThis, const FLOAT3D &vSrc)
+{
+  CNavigationMarker *pnmMin = NULL;
+  FLOAT fMinDist = UpperLimit(0.0f);
+  // for each sector this entity is in
+  {FOREACHSRCOFDST(penThis->en_rdSectors, CBrushSector, bsc_rsEntities, pbsc)
+    // for each navigation marker in that sector
+    {FOREACHDSTOFSRC(pbsc->bsc_rsEntities, CEntity, en_rdSectors, pen)
+      if (!IsOfClass(pen, "NavigationMarker")) {
+        continue;
+      }
+      CNavigationMarker &nm = (CNavigationMarker&)*pen;
+
+      // get distance from source
+      FLOAT fDist = (vSrc-nm.GetPlacement().pl_PositionVector).Length();
+      // if closer than best found
+      if(fDist<fMinDist) {
+        // remember it
+        fMinDist = fDist;
+        pnmMin = &nm;
+      }
+    ENDFOR}
+  ENDFOR}
+
+  return pnmMin;
+}
+
+void CECIL_MarkerBenchmark(INDEX ctQueries)
+{
+  ctQueries = ClampDn(ctQueries, (INDEX)1);
+  _ulBenchSeed = 0x5EED;
+
+  CWorld &wo = _pNetwork->ga_World;
+
+  // entities that are inside some sectors
+  CDynamicContainer<CEntity> cenQuery;
+
+  {FOREACHINDYNAMICCONTAINER(wo.wo_cenEntities, CEntity, iten) {
+    CEntity *pen = iten;
+
+    if (pen->en_rdSectors.IsEmpty() || IsOfClass(pen, "NavigationMarker")) {
+      continue;
+    }
+    cenQuery.Add(pen);
+  }}
+
+  if (cenQuery.Count()==0) {
+    CPrintF("No entities in sectors in the current world!\n");
+    return;
+  }
+
+  // random positions around random entities
+  CStaticArray<CEntity *> apenQueries;
+  CStaticArray<FLOAT3D> avQueries;
+  apenQueries.New(ctQueries);
+  avQueries.New(ctQueries);
+
+  INDEX iQuery;
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    CEntity *pen = cenQuery.Pointer(BenchRandom(cenQuery.Count()));
+    apenQueries[iQuery] = pen;
+    avQueries[iQuery] = pen->GetPlacement().pl_PositionVector + FLOAT3D(
+      (BenchRandom(1000)-500)*0.032f, (BenchRandom(1000)-500)*0.008f, (BenchRandom(1000)-500)*0.032f);
+  }
+
+  // build the index beforehand
+  UpdateMarkerIndex(&wo);
+
+  // spatial index
+  CTimerValue tvStart = _pTimer->GetHighPrecisionTimer();
+
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    CEntity *penMarker;
+    FLOAT3D vPath;
+    FindClosestMarker(apenQueries[iQuery], avQueries[iQuery], penMarker, vPath);
+  }
+
+  const DOUBLE dIndex = (_pTimer->GetHighPrecisionTimer()-tvStart).GetSeconds();
+
+  // sector walk
+  INDEX ctFound = 0;
+  tvStart = _pTimer->GetHighPrecisionTimer();
+
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    if (ReferenceClosestMarker(apenQueries[iQuery], avQueries[iQuery])!=NULL) {
+      ctFound++;
+    }
+  }
+
+  const DOUBLE dSectors = (_pTimer->GetHighPrecisionTimer()-tvStart).GetSeconds();
+
+  // compare results
+  INDEX ctMismatches = 0;
+
+  for (iQuery=0; iQuery<ctQueries; iQuery++) {
+    const FLOAT3D &vSrc = avQueries[iQuery];
+
+    CEntity *penMarker;
+    FLOAT3D vPath;
+    FindClosestMarker(apenQueries[iQuery], vSrc, penMarker, vPath);
+    CNavigationMarker *pnmSectors = ReferenceClosestMarker(apenQueries[iQuery], vSrc);
+
+    // equally close markers must be picked the same way too
+    if (penMarker!=pnmSectors) {
+      ctMismatches++;
+    }
+  }
+
+  CPrintF("  Spatial index: %.3f ms\n", dIndex*1000.0);
+  CPrintF("  Sector walk:   %.3f ms\n", dSectors*1000.0);
+  CPrintF("Replayed %d queries around %d entities with %d marker entries (%d found)\n",
+    ctQueries, cenQuery.Count(), _ameMarkers.Count(), ctFound);
+
+  if (ctMismatches==0) {
+    CPrintF("^c00ff00PASS^r: all markers match the sector walk\n");
+  } else {
+    CPrintF("^cff0000FAIL^r: %d markers differ from the sector walk\n", ctMismatches);
+  }
+}
@@ -19,8 +19,11 @@ public:
 
   class CNavigationMarker *pn_pnmMarker; // the marker itself
 
-  CListNode pn_lnInOpen;  // for linking in open/closed lists
-  CListNode pn_lnInClosed;
+  // [Cecil] 2026-10-19: Nodes are kept between searches and their state is only valid for the search that has touched them last
+  ULONG pn_ulSearch; // search that has touched this node last
+  INDEX pn_iOpen;    // index in the open heap or -1 if not in it
+  BOOL pn_bClosed;   // already expanded
+  ULONG pn_ulOrder;  // when the node has been added to the open heap
 
   CPathNode *pn_ppnParent;  // best found parent in path yet
   FLOAT pn_fG;  // total cost to get here through the best parent
@@ -35,6 +38,14 @@ DECL_DLL void PATH_FindFirstMarker(
 DECL_DLL void PATH_FindNextMarker(
     CEntity *penThis, const FLOAT3D &vSrc, const FLOAT3D &vDst, CEntity *&penMarker, FLOAT3D &vPath);
 
+// [Cecil] 2026-10-19: Rebuild spatial index of navigation markers before the next search
+DECL_DLL void PATH_MarkersChanged(void);
+
+// [Cecil] 2026-10-19: Compare path finding against the old sorted list search on a synthetic marker graph
+DECL_DLL void CECIL_PathBenchmark(INDEX ctQueries);
+
+// [Cecil] 2026-10-19: Compare closest marker lookups against the old sector walk in the current world
+DECL_DLL void CECIL_MarkerBenchmark(INDEX ctQueries);
 
 #endif  /* include-once check. */
 
@@ -64,6 +64,12 @@ properties:
   16 FLOAT m_fDustStretch = 0.0f,
   17 BOOL m_bTouchedGround=FALSE,
   18 CEntityPointer m_penFallFXPapa,
+  19 BOOL m_bRecyclable = FALSE, // [Cecil] 2026-10-19: can be reused after finishing
+  20 INDEX m_iRecycled = 0,      // [Cecil] 2026-10-19: order of finishing while waiting to be reused
+
+{
+  CRecycleLink m_rlPool; // [Cecil] 2026-10-19: link in the pool of finished debris
+}
 
 
 components:
@@ -73,6 +79,44 @@ components:
 
 functions:
 
+  // [Cecil] 2026-10-19: Constructor
+  void CDebris(void)
+  {
+    m_rlPool.Init(this, ERK_DEBRIS, &m_iRecycled);
+  }
+
+  // [Cecil] 2026-10-19: Wait to be reused again
+  void Read_t(CTStream *istr) // throw char *
+  {
+    CMovableModelEntity::Read_t(istr);
+
+    if (m_iRecycled > 0) {
+      m_rlPool.Relink();
+    }
+  }
+
+  // [Cecil] 2026-10-19: Wait to be reused instead of being destroyed, if possible
+  void Finish(void)
+  {
+    if (!m_bRecyclable || IsPredictor()) {
+      Destroy();
+      return;
+    }
+
+    // stop and hide it until it's reused
+    ForceFullStop();
+    SetParent(NULL);
+    SetFlags(GetFlags() & ~(ENF_SEETHROUGH|ENF_NOSHADINGINFO));
+    SetPhysicsFlags(EPF_MODEL_IMMATERIAL);
+    SetCollisionFlags(ECF_IMMATERIAL);
+    InitAsVoid();
+
+    // don't keep other entities while waiting
+    m_penFallFXPapa = NULL;
+
+    m_rlPool.Park();
+  }
+
   /* Entity info */
   void *GetEntityInfo(void) {
     return GetStdEntityInfo((EntityInfoBodyType)m_iBodyType);
@@ -162,7 +206,7 @@ functions:
   // spawn effect
   void SpawnEffect(const CPlacement3D &plEffect, const class ESpawnEffect &eSpawnEffect)
   {
-    CEntityPointer penEffect = CreateEntity(plEffect, CLASS_BASIC_EFFECT);
+    CEntityPointer penEffect = CreateRecycledEffect(this, plEffect); // [Cecil] 2026-10-19: Reuse finished effects
     penEffect->Initialize(eSpawnEffect);
   };
 
@@ -350,7 +394,7 @@ procedures:
         }
         resume;
       }
-      on (EDeath) : { Destroy(); return; }
+      on (EDeath) : { Finish(); return; } // [Cecil] 2026-10-19
       on (ETimer) : { stop; }
     }
 
@@ -362,7 +406,7 @@ procedures:
     autowait(m_fFadeTime);
 
     // cease to exist
-    Destroy();
+    Finish(); // [Cecil] 2026-10-19
 
     return;
   }
@@ -169,10 +169,15 @@ properties:
 
 181 BOOL  m_bResizeAttachments "Stretch attachments" = FALSE, // for small enemies with big guns
 
+182 CEntityPointer m_penPoolNext, // [Cecil] 2026-10-19: next prepared copy in the pool of an enemy spawner
+
 //171 INDEX m_iTacticsRetried = 0,
 
   {
     TIME m_tmPredict;  // time to predict the entity to
+    CWorldCount m_wcCount; // [Cecil] 2026-10-19: what this enemy adds to the world totals
+    CListNode m_lnInFuss; // [Cecil] 2026-10-19: for linking in the list of fuss makers
+    INDEX m_iFussScore; // [Cecil] 2026-10-19: score added to the total of fuss makers
   }
 
 
@@ -210,6 +215,16 @@ functions:
   void CEnemyBase(void)
   {
     m_tmPredict = 0;
+    m_iFussScore = 0;
+  }
+
+  // [Cecil] 2026-10-19: Destructor
+  void ~CEnemyBase(void)
+  {
+    // music holder might be destroyed before the enemy
+    if (m_lnInFuss.IsLinked()) {
+      m_lnInFuss.Remove();
+    }
   }
 
   // called by other entities to set time prediction parameter
@@ -244,6 +259,36 @@ functions:
     return TRUE;
   }
 
+  // [Cecil] 2026-10-19: How many enemies this one counts as in the world totals
+  virtual INDEX GetTotalCount(void)
+  {
+    return 1;
+  }
+
+  // [Cecil] 2026-10-19: Update what this enemy adds to the world totals
+  void UpdateWorldCount(void)
+  {
+    m_wcCount.Set(GetWorld(), (m_bTemplate ? 0 : GetTotalCount()), 0);
+  }
+
+  // [Cecil] 2026-10-19: Count in the world totals
+  void OnInitialize(const CEntityEvent &eeInput)
+  {
+    UpdateWorldCount();
+    CMovableModelEntity::OnInitialize(eeInput);
+  }
+
+  // [Cecil] 2026-10-19: Remove from the world totals and from fuss makers
+  void OnEnd(void)
+  {
+    m_wcCount.Set(NULL, 0, 0);
+
+    if (m_lnInFuss.IsLinked()) {
+      RemoveFromFuss();
+    }
+    CMovableModelEntity::OnEnd();
+  }
+
   virtual BOOL ForcesCannonballToExplode(void)
   {
     return FALSE;
@@ -589,9 +634,12 @@ functions:
   void Read_t( CTStream *istr) {
     CMovableModelEntity::Read_t(istr);
 
+    // [Cecil] 2026-10-19: Count in the world totals
+    UpdateWorldCount();
+
     // add to fuss if needed
     if (m_penMainMusicHolder!=NULL) {
-      ((CMusicHolder&)*m_penMainMusicHolder).m_cenFussMakers.Add(this);
+      ((CMusicHolder&)*m_penMainMusicHolder).InsertFussMaker(this);
     }
   };
 
@@ -716,7 +764,7 @@ functions:
 
       // spawn blood spray
       CPlacement3D plSpray = CPlacement3D( vHitPoint, ANGLE3D(0, 0, 0));
-      m_penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+      m_penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
       if(m_sptType != SPT_ELECTRICITY_SPARKS)
       {
         m_penSpray->SetParent( this);
@@ -850,7 +898,7 @@ functions:
     // if no music holder remembered - not in fuss
     if (m_penMainMusicHolder==NULL) {
       // find main music holder
-      m_penMainMusicHolder = _pNetwork->GetEntityWithName("MusicHolder", 0);
+      m_penMainMusicHolder = GetMainMusicHolder(); // [Cecil] 2026-10-19: Remembered
       // if no music holder found
       if (m_penMainMusicHolder==NULL) {
         // just remember last fuss time
@@ -858,25 +906,27 @@ functions:
         // cannot make fuss
         return;
       }
+      // remember last fuss time
+      m_tmLastFussTime = _pTimer->CurrentTick();
       // add to end of fuss list
-      ((CMusicHolder&)*m_penMainMusicHolder).m_cenFussMakers.Add(this);
+      ((CMusicHolder&)*m_penMainMusicHolder).AddFussMaker(this);
       // if boss set as boss
       if (m_bBoss) {
         ((CMusicHolder&)*m_penMainMusicHolder).m_penBoss = this;
       }
-      // remember last fuss time
-      m_tmLastFussTime = _pTimer->CurrentTick();
 
     // if music holder remembered - still in fuss
     } else {
       // must be in list
-      ASSERT(((CMusicHolder&)*m_penMainMusicHolder).m_cenFussMakers.IsMember(this));
+      ASSERT(m_lnInFuss.IsLinked());
       // if boss set as boss
       if (m_bBoss) {
         ((CMusicHolder&)*m_penMainMusicHolder).m_penBoss = this;
       }
       // just remember last fuss time
       m_tmLastFussTime = _pTimer->CurrentTick();
+      // [Cecil] 2026-10-19: Move to the end of fuss list
+      ((CMusicHolder&)*m_penMainMusicHolder).RefreshFussMaker(this);
     }
   }
   void RemoveFromFuss(void)
@@ -890,7 +940,7 @@ functions:
       return;
     }
     // just remove from list
-    ((CMusicHolder&)*m_penMainMusicHolder).m_cenFussMakers.Remove(this);
+    ((CMusicHolder&)*m_penMainMusicHolder).RemoveFussMaker(this);
     // if boss, clear boss
     if (m_bBoss) {
       if (((CMusicHolder&)*m_penMainMusicHolder).m_penBoss != this) {
@@ -1,6 +1,9 @@
 304
 %{
 #include "StdH.h"
+
+// [Cecil] 2026-10-19: Report time spent on spawning each group
+extern INDEX MOD_bSpawnerTiming;
 %}
 
 
@@ -52,6 +55,18 @@ properties:
  60 CEntityPointer m_penTacticsHolder  "Tactics Holder",
  61 BOOL m_bTacticsAutostart           "Tactics autostart" = TRUE,
 
+ 71 INDEX m_ctPoolSize "Pool size" = 0, // [Cecil] 2026-10-19: how many template copies to prepare on level start
+ 72 CEntityPointer m_penPool,           // [Cecil] 2026-10-19: first prepared copy
+
+  {
+    CWorldCount m_wcCount; // [Cecil] 2026-10-19: what this spawner adds to the world totals
+
+    // [Cecil] 2026-10-19: Time spent on spawning the current group
+    DOUBLE m_dGroupTime;
+    DOUBLE m_dGroupTimeMax;
+    INDEX m_ctGroupPooled;
+  }
+
  
 
 components:
@@ -63,11 +78,67 @@ components:
 
 functions:
 
+  // [Cecil] 2026-10-19: Constructor
+  void CEnemySpawner(void)
+  {
+    m_dGroupTime = 0.0;
+    m_dGroupTimeMax = 0.0;
+    m_ctGroupPooled = 0;
+  }
+
   void Precache(void)
   {
     PrecacheClass(CLASS_BASIC_EFFECT, BET_TELEPORT);
   }
 
+  // [Cecil] 2026-10-19: Update what this spawner adds to the world totals
+  void UpdateWorldCount(void)
+  {
+    // how many enemies each spawned one counts as
+    INDEX ctPerEnemy = 1;
+
+    if (m_penTarget!=NULL && IsDerivedFromClass(m_penTarget, "Enemy Base")) {
+      ctPerEnemy = ((CEnemyBase&)*m_penTarget).GetTotalCount();
+    }
+
+    INDEX ctEnemies = 0;
+
+    // teleporters move existing enemies
+    if (m_estType!=EST_TELEPORTER) {
+      ctEnemies = m_ctTotal*ctPerEnemy;
+    }
+
+    m_wcCount.Set(GetWorld(), ctEnemies, 0);
+  }
+
+  // [Cecil] 2026-10-19: Count in the world totals
+  void OnInitialize(const CEntityEvent &eeInput)
+  {
+    UpdateWorldCount();
+    CRationalEntity::OnInitialize(eeInput);
+  }
+
+  // [Cecil] 2026-10-19: Remove from the world totals
+  void OnEnd(void)
+  {
+    m_wcCount.Set(NULL, 0, 0);
+    m_wcCount.SetPending(NULL);
+
+    // destroy copies that haven't been spawned, however the spawner is destroyed
+    DestroyPool();
+    CRationalEntity::OnEnd();
+  }
+
+  /* Read from stream. */
+  void Read_t( CTStream *istr) // throw char *
+  {
+    CRationalEntity::Read_t(istr);
+
+    // [Cecil] 2026-10-19: Count in the world totals once they are needed, since the template might not be read yet
+    m_wcCount.Set(NULL, 0, 0);
+    m_wcCount.SetPending(this);
+  }
+
 
   const CTString &GetDescription(void) const
   {
@@ -134,16 +205,92 @@ functions:
     return TRUE;
   }
 
+  // [Cecil] 2026-10-19: Copy template entity somewhere far away
+  CEntity *CopyTemplate(void)
+  {
+    return GetWorld()->CopyEntityInWorld( *m_penTarget,
+      CPlacement3D(FLOAT3D(-32000.0f+FRnd()*200.0f, -32000.0f+FRnd()*200.0f, 0), ANGLE3D(0, 0, 0)) );
+  }
+
+  // [Cecil] 2026-10-19: Prepare copies of the template in advance, so they don't have to be made
+  // on the tick when the group is spawned; they stay templates until they are taken from the pool
+  void FillPool(void)
+  {
+    if (m_estType==EST_TELEPORTER || !CheckTemplateValid(m_penTarget)) {
+      return;
+    }
+
+    const INDEX ctPool = Min(m_ctPoolSize, m_ctTotal);
+
+    for (INDEX i = 0; i < ctPool; i++) {
+      CEnemyBase *peb = (CEnemyBase *)CopyTemplate();
+      peb->m_penPoolNext = m_penPool;
+      m_penPool = peb;
+    }
+  }
+
+  // [Cecil] 2026-10-19: Take one prepared copy of the template
+  CEntity *TakeFromPool(void)
+  {
+    while (m_penPool!=NULL) {
+      CEnemyBase *peb = (CEnemyBase *)&*m_penPool;
+      m_penPool = peb->m_penPoolNext;
+      peb->m_penPoolNext = NULL;
+
+      // skip copies that have been destroyed by something else
+      if (!(peb->GetFlags() & ENF_DELETED)) {
+        return peb;
+      }
+    }
+
+    return NULL;
+  }
+
+  // [Cecil] 2026-10-19: Destroy copies that haven't been spawned
+  void DestroyPool(void)
+  {
+    CEntity *pen;
+
+    while ((pen = TakeFromPool()) != NULL) {
+      pen->Destroy();
+    }
+  }
+
+  // [Cecil] 2026-10-19: Report time spent on spawning the last group
+  void ReportGroupTime(INDEX ctSpawned)
+  {
+    if (MOD_bSpawnerTiming && ctSpawned > 0) {
+      CPrintF("'%s': spawned %d (%d pooled) in %.3f ms, %.3f ms max\n", (const char *)m_strName, ctSpawned, m_ctGroupPooled,
+        m_dGroupTime * 1000.0, m_dGroupTimeMax * 1000.0);
+    }
+
+    m_dGroupTime = 0.0;
+    m_dGroupTimeMax = 0.0;
+    m_ctGroupPooled = 0;
+  }
+
   // spawn new entity
   void SpawnEntity(BOOL bCopy) {
     // spawn new entity if of class basic enemy
     if (CheckTemplateValid(m_penTarget)) {
+      // [Cecil] 2026-10-19: Measure spawning
+      CTimerValue tvStart;
+
+      if (MOD_bSpawnerTiming) {
+        tvStart = _pTimer->GetHighPrecisionTimer();
+      }
 
       CEntity *pen = NULL;
       if (bCopy) {
-        // copy template entity
-        pen = GetWorld()->CopyEntityInWorld( *m_penTarget,
-          CPlacement3D(FLOAT3D(-32000.0f+FRnd()*200.0f, -32000.0f+FRnd()*200.0f, 0), ANGLE3D(0, 0, 0)) );
+        // [Cecil] 2026-10-19: Use prepared copy, if there are any left
+        pen = TakeFromPool();
+
+        if (pen!=NULL) {
+          m_ctGroupPooled++;
+        } else {
+          // copy template entity
+          pen = CopyTemplate();
+        }
 
         // change needed properties
         pen->End();
@@ -160,6 +307,7 @@ functions:
       } else {
         pen = m_penTarget;
         m_penTarget = NULL;
+        UpdateWorldCount(); // [Cecil] 2026-10-19
       }
       
       // adjust circle radii to account for enemy size
@@ -203,7 +351,13 @@ functions:
           }
         }
       }
-      
+
+      // [Cecil] 2026-10-19: Count spawning time
+      if (MOD_bSpawnerTiming) {
+        const DOUBLE dTime = (_pTimer->GetHighPrecisionTimer() - tvStart).GetSeconds();
+        m_dGroupTime += dTime;
+        m_dGroupTimeMax = Max(m_dGroupTimeMax, dTime);
+      }
     }
   };
 
@@ -249,8 +403,10 @@ procedures:
 
       // count total enemies spawned
       m_ctTotal--;
+      UpdateWorldCount(); // [Cecil] 2026-10-19
       // if no more left
       if (m_ctTotal<=0) {
+        ReportGroupTime(m_iInGroup + 1); // [Cecil] 2026-10-19
         // finish entire spawner
         return EEnd();
       }
@@ -269,6 +425,7 @@ procedures:
       // if entire group spawned
       if (m_iInGroup>=m_ctGroupSize) {
         if (!(m_estType==EST_MAINTAINGROUP && m_iEnemiesTriggered>0)) {
+          ReportGroupTime(m_iInGroup); // [Cecil] 2026-10-19
           // finish
           return EReturn();
         }
@@ -476,6 +633,12 @@ procedures:
       m_penTarget = m_penSeriousTarget;
     }
 
+    // [Cecil] 2026-10-19: Type, template and total might have changed
+    UpdateWorldCount();
+
+    // [Cecil] 2026-10-19: Prepare copies of the final template
+    FillPool();
+
     if (m_estType==EST_MAINTAINGROUP) {
       m_iEnemiesTriggered = m_ctGroupSize;
     }
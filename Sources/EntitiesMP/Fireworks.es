@@ -56,11 +56,12 @@ functions:
       m_emEmiter.AnimateParticles();
       m_tmLastAnimation=tmNow;
       
-      for(INDEX i=0; i<m_emEmiter.em_aepParticles.Count(); i++)
+      for(INDEX i=0; i<m_emEmiter.Count(); i++)
       {
-        CEmittedParticle &ep=m_emEmiter.em_aepParticles[i];
-        if(ep.ep_tmEmitted<0) {continue;};
-        FLOAT fLiving=tmNow-ep.ep_tmEmitted;
+        // [Cecil] Separate particle fields
+        const FLOAT tmEmitted=m_emEmiter.em_atmEmitted[i];
+        if(tmEmitted<0) {continue;};
+        FLOAT fLiving=tmNow-tmEmitted;
         FLOAT fSpeed=0.0f;
 
         if( fLiving>=6.0f)
@@ -77,9 +78,10 @@ functions:
           fSpeed=fSpeedRatio*LAUNCH_SPEED;
           */
         }
-        FLOAT3D vNormalized=ep.ep_vSpeed;
+        FLOAT3D &vSpeed=m_emEmiter.em_avSpeed[i];
+        FLOAT3D vNormalized=vSpeed;
         vNormalized.Normalize();
-        ep.ep_vSpeed=vNormalized*(4.0f+fSpeed);
+        vSpeed=vNormalized*(4.0f+fSpeed);
       }
     }
     m_emEmiter.RenderParticles();
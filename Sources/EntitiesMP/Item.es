@@ -282,6 +282,7 @@ procedures:
   {
     // hide yourself
     SwitchToEditorModel();
+    CECIL_ImportantEntityChanged(this); // [Cecil]
     if ((m_bPickupOnce||m_bRespawn)) {
       SendToTarget(m_penTarget, EET_TRIGGER, NULL);
     }
@@ -298,6 +299,7 @@ procedures:
       }
       // show yourself
       SwitchToModel();
+      CECIL_ImportantEntityChanged(this); // [Cecil]
     
     // cease to exist
     } else {
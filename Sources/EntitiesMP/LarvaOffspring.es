@@ -200,7 +200,7 @@ void ProjectileHit(void)
 
 // spawn effect
 void SpawnEffect(const CPlacement3D &plEffect, const ESpawnEffect &eSpawnEffect) {
-  CEntityPointer penEffect = CreateEntity(plEffect, CLASS_BASIC_EFFECT);
+  CEntityPointer penEffect = CreateRecycledEffect(this, plEffect); // [Cecil] 2026-10-19: Reuse finished effects
   penEffect->Initialize(eSpawnEffect);
 };
 
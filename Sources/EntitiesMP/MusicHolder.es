@@ -101,8 +101,10 @@ properties:
 134 INDEX m_iSubChannel4 = 1,
 
   {
-    // array of enemies that make fuss
-    CDynamicContainer<CEntity> m_cenFussMakers;
+    // enemies that make fuss
+    // [Cecil] 2026-10-19: Ordered from the oldest fuss to the newest, with their total score
+    CListHead m_lhFussMakers;
+    INDEX m_iFussScore;
   }
 
 components:
@@ -112,82 +114,114 @@ components:
 
 functions:
   // count enemies in current world
+  // [Cecil] 2026-10-19: Entities maintain the totals themselves
   void CountEnemies(void)
   {
-    m_ctEnemiesInWorld = 0;
-    m_ctSecretsInWorld = 0;
-    // for each entity in the world
-    {FOREACHINDYNAMICCONTAINER(GetWorld()->wo_cenEntities, CEntity, iten) {
-      CEntity *pen = iten;
-      // if enemybase
-      if (IsDerivedFromClass(pen, "Enemy Base")) {
-        CEnemyBase *penEnemy = (CEnemyBase *)pen;
-        // if not template
-        if (!penEnemy->m_bTemplate) {
-          // count one
-          m_ctEnemiesInWorld++;
-		      // if this is a woman kamikaze carrier, add another one to count
-		      if (IsOfClass(pen, "Woman")) {
-			      if (((CWoman *)&*pen)->m_bKamikazeCarrier) { m_ctEnemiesInWorld++; }
-		      }
-        }
-      // if spawner
-      } else if (IsDerivedFromClass(pen, "Enemy Spawner")) {
-        CEnemySpawner *penSpawner = (CEnemySpawner *)pen;
-        // if not teleporting
-        if (penSpawner->m_estType!=EST_TELEPORTER) {
-          // add total count
-          m_ctEnemiesInWorld+=penSpawner->m_ctTotal;
-          // if this spawner points to a woman kamikaze carrier template, increase count once more
-          if (penSpawner->m_penTarget) {
-            if (IsOfClass(penSpawner->m_penTarget, "Woman")) {
-              if (((CWoman *)&*penSpawner->m_penTarget)->m_bKamikazeCarrier) { m_ctEnemiesInWorld+=penSpawner->m_ctTotal; }
-            }
-          }
-        }
-      // if trigger
-      } else if (IsDerivedFromClass(pen, "Trigger")) {
-        CTrigger *penTrigger = (CTrigger *)pen;
-        // if has score
-        if (penTrigger->m_fScore>0) {
-          // it counts as a secret
-          m_ctSecretsInWorld++;
-        }
-      }
-    }}
+    GetWorldCounts(GetWorld(), m_ctEnemiesInWorld, m_ctSecretsInWorld);
+  }
+
+  // [Cecil] 2026-10-19: Constructor
+  void CMusicHolder(void)
+  {
+    m_iFussScore = 0;
+    ResetMainMusicHolder();
+  }
+
+  // [Cecil] 2026-10-19: Destructor
+  void ~CMusicHolder(void)
+  {
+    // detach enemies that are still linked
+    FORDELETELIST(CEnemyBase, m_lnInFuss, m_lhFussMakers, iten) {
+      iten->m_lnInFuss.Remove();
+      iten->m_iFussScore = 0;
+    }
+    m_iFussScore = 0;
+
+    ResetMainMusicHolder();
+  }
+
+  // [Cecil] 2026-10-19: Main music holder might change
+  void OnEnd(void)
+  {
+    ResetMainMusicHolder();
+    CRationalEntity::OnEnd();
+  }
+
+  // [Cecil] 2026-10-19: Add enemy that has just made fuss
+  void AddFussMaker(CEntity *pen)
+  {
+    CEnemyBase *penEnemy = (CEnemyBase *)pen;
+    ASSERT(!penEnemy->m_lnInFuss.IsLinked());
+    m_lhFussMakers.AddTail(penEnemy->m_lnInFuss);
+
+    penEnemy->m_iFussScore = penEnemy->m_iScore;
+    m_iFussScore += penEnemy->m_iFussScore;
+  }
+
+  // [Cecil] 2026-10-19: Add enemy with any fuss time (e.g. after loading)
+  void InsertFussMaker(CEntity *pen)
+  {
+    CEnemyBase *penEnemy = (CEnemyBase *)pen;
+    ASSERT(!penEnemy->m_lnInFuss.IsLinked());
+
+    // find the first enemy that has made fuss later
+    LISTITER(CEnemyBase, m_lnInFuss) iten(m_lhFussMakers);
+    while (!iten.IsPastEnd() && iten->m_tmLastFussTime<=penEnemy->m_tmLastFussTime) {
+      iten.MoveToNext();
+    }
+
+    if (iten.IsPastEnd()) {
+      m_lhFussMakers.AddTail(penEnemy->m_lnInFuss);
+    } else {
+      iten.InsertBeforeCurrent(penEnemy->m_lnInFuss);
+    }
+
+    penEnemy->m_iFussScore = penEnemy->m_iScore;
+    m_iFussScore += penEnemy->m_iFussScore;
+  }
+
+  // [Cecil] 2026-10-19: Move enemy that has made fuss again to the end
+  void RefreshFussMaker(CEntity *pen)
+  {
+    CEnemyBase *penEnemy = (CEnemyBase *)pen;
+    ASSERT(penEnemy->m_lnInFuss.IsLinked());
+    RemoveFussMaker(penEnemy);
+    AddFussMaker(penEnemy);
+  }
+
+  // [Cecil] 2026-10-19: Remove enemy from fuss makers
+  void RemoveFussMaker(CEntity *pen)
+  {
+    CEnemyBase *penEnemy = (CEnemyBase *)pen;
+    ASSERT(penEnemy->m_lnInFuss.IsLinked());
+    penEnemy->m_lnInFuss.Remove();
+
+    m_iFussScore -= penEnemy->m_iFussScore;
+    penEnemy->m_iFussScore = 0;
   }
 
   // check for stale fuss-makers
+  // [Cecil] 2026-10-19: Only the oldest ones need to be checked
   void CheckOldFussMakers(void)
   {
     TIME tmNow = _pTimer->CurrentTick();
     TIME tmTooOld = tmNow-10.0f;
-    CDynamicContainer<CEntity> cenOldFussMakers;
-    // for each fussmaker
-    {FOREACHINDYNAMICCONTAINER(m_cenFussMakers, CEntity, itenFussMaker) {
-      CEnemyBase & enFussMaker = (CEnemyBase&)*itenFussMaker;
-      // if haven't done fuss for too long
-      if (enFussMaker.m_tmLastFussTime<tmTooOld) {
-        // add to old fuss makers
-        cenOldFussMakers.Add(&enFussMaker);
+    // while there are fussmakers
+    while (!m_lhFussMakers.IsEmpty()) {
+      CEnemyBase &enFussMaker = *LIST_HEAD(m_lhFussMakers, CEnemyBase, m_lnInFuss);
+      // if the oldest one has made fuss recently, so did the rest
+      if (enFussMaker.m_tmLastFussTime>=tmTooOld) {
+        break;
       }
-    }}
-    // for each old fussmaker
-    {FOREACHINDYNAMICCONTAINER(cenOldFussMakers, CEntity, itenOldFussMaker) {
-      CEnemyBase &enOldFussMaker = (CEnemyBase&)*itenOldFussMaker;
       // remove from fuss
-      enOldFussMaker.RemoveFromFuss();
-    }}
+      enFussMaker.RemoveFromFuss();
+      ASSERT(!enFussMaker.m_lnInFuss.IsLinked());
+    }
   }
   
   // get total score of all active fuss makers
   INDEX GetFussMakersScore(void) {
-    INDEX iScore = 0;
-    {FOREACHINDYNAMICCONTAINER(m_cenFussMakers, CEntity, itenFussMaker) {
-      CEnemyBase &enFussMaker = (CEnemyBase&)*itenFussMaker;
-      iScore += enFussMaker.m_iScore;
-    }}
-    return iScore;
+    return m_iFussScore;
   }
 
   // change given music channel
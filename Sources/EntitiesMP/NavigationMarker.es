@@ -46,9 +46,19 @@ functions:
   void CNavigationMarker(void)
   {
     m_ppnNode = NULL;
+
+    // [Cecil] 2026-10-19: Update spatial index
+    PATH_MarkersChanged();
   }
   void ~CNavigationMarker(void)
   {
+    // [Cecil] 2026-10-19: Update spatial index
+    PATH_MarkersChanged();
+
+    // [Cecil] 2026-10-19: Nodes are kept between searches
+    if (m_ppnNode != NULL) {
+      delete m_ppnNode;
+    }
     ASSERT(m_ppnNode == NULL);
   }
 
@@ -56,9 +66,32 @@ functions:
   void Read_t( CTStream *istr) // throw char *
   {
     CEntity::Read_t(istr);
+
+    // [Cecil] 2026-10-19: Nodes are kept between searches
+    if (m_ppnNode != NULL) {
+      delete m_ppnNode;
+    }
     m_ppnNode = NULL;
   }
   
+  // [Cecil] 2026-10-19: Update spatial index when moved in the editor
+  void SetPlacement_internal(const CPlacement3D &plNew, const FLOATmatrix3D &mRotation, BOOL bNear)
+  {
+    CEntity::SetPlacement_internal(plNew, mRotation, bNear);
+
+    // markers with parents aren't indexed
+    if (GetParent() == NULL) {
+      PATH_MarkersChanged();
+    }
+  }
+
+  // [Cecil] 2026-10-19: Update spatial index when removed in the editor
+  void OnEnd(void)
+  {
+    PATH_MarkersChanged();
+    CEntity::OnEnd();
+  }
+
   CEntity *GetTarget(void) const { return m_penTarget0; };
 
   /* Entity info */
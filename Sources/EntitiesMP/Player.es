@@ -1252,6 +1252,11 @@ functions:
   // [Cecil] Apply action for bots
   virtual void BotApplyAction(CPlayerAction &paAction) {};
 
+  // [Cecil] 2026-10-19: Update ray hit for weapon target
+  virtual void UpdateTargetingInfo(void) {
+    GetPlayerWeapons()->UpdateTargetingInfo();
+  };
+
   INDEX GenderSound(INDEX iSound)
   {
     return iSound+m_iGender*GENDEROFFSET;
@@ -2132,7 +2137,7 @@ functions:
   void FindMusicHolder(void)
   {
     if (m_penMainMusicHolder==NULL) {
-      m_penMainMusicHolder = _pNetwork->GetEntityWithName("MusicHolder", 0);
+      m_penMainMusicHolder = GetMainMusicHolder(); // [Cecil] 2026-10-19: Remembered
     }
   }
 
@@ -2168,7 +2173,7 @@ functions:
       return FALSE;
     }
     // if no enemies - no fuss
-    return ((CMusicHolder*)&*m_penMainMusicHolder)->m_cenFussMakers.Count()>0;
+    return !((CMusicHolder*)&*m_penMainMusicHolder)->m_lhFussMakers.IsEmpty();
   }
 
   void SetDefaultMouthPitch(void)
@@ -2723,7 +2728,7 @@ functions:
     }
 
     // update ray hit for weapon target
-    GetPlayerWeapons()->UpdateTargetingInfo();
+    UpdateTargetingInfo(); // [Cecil]
 
     if (m_pen3rdPersonView!=NULL) {
       ((CPlayerView&)*m_pen3rdPersonView).PostMoving();
@@ -2942,7 +2947,7 @@ functions:
 
       // spawn blood spray
       CPlacement3D plSpray = CPlacement3D( vHitPoint, ANGLE3D(0, 0, 0));
-      m_penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+      m_penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
       m_penSpray->SetParent( this);
       ESpawnSpray eSpawnSpray;
       eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -620,7 +620,6 @@ properties:
 272 FLOAT m_tmLastChainsawSpray = 0.0f,
 
 {
-  CEntity *penBullet;
   CPlacement3D plBullet;
   FLOAT3D vBulletDestination;
 }
@@ -1151,8 +1150,8 @@ functions:
     }
   }
 
-  // cast a ray from weapon
-  void UpdateTargetingInfo(void)
+  // [Cecil] 2026-10-19: Cast a ray from weapon and only remember what it hit
+  void UpdateRayHit(void)
   {
     // crosshair start position from weapon
     CPlacement3D plCrosshair;
@@ -1175,6 +1174,21 @@ functions:
     m_fRayHitDistance = crRay.cr_fHitDistance;
     m_fEnemyHealth = 0.0f;
 
+    // if didn't hit anything
+    if (m_penRayHit == NULL) {
+      // remember position ahead
+      FLOAT3D vDir = crRay.cr_vTarget-crRay.cr_vOrigin;
+      vDir.Normalize();
+      m_vRayHit = crRay.cr_vOrigin+vDir*50.0f;
+    }
+  };
+
+  // cast a ray from weapon
+  void UpdateTargetingInfo(void)
+  {
+    // [Cecil] Cast the ray itself
+    UpdateRayHit();
+
     // set some targeting properties (snooping and such...)
     TIME tmNow = _pTimer->CurrentTick();
     if( m_penRayHit!=NULL)
@@ -1256,10 +1270,6 @@ functions:
     else {
       // not targeting player
       m_tmTargetingStarted = 0; 
-      // remember position ahead
-      FLOAT3D vDir = crRay.cr_vTarget-crRay.cr_vOrigin;
-      vDir.Normalize();
-      m_vRayHit = crRay.cr_vOrigin+vDir*50.0f;
     }
 
     // determine snooping time
@@ -2088,44 +2098,34 @@ functions:
   };
 
   // prepare Bullet
-  void PrepareSniperBullet(FLOAT fX, FLOAT fY, FLOAT fDamage, FLOAT fImprecission) {
+  // [Cecil] Prepare instant bullet without creating an entity
+  CHitscanBullet PrepareSniperBullet(FLOAT fX, FLOAT fY, FLOAT fDamage, FLOAT fImprecission) {
     // bullet start position
     CalcWeaponPositionImprecise(FLOAT3D(fX, fY, 0), plBullet, TRUE, fImprecission);
-    // create bullet
-    penBullet = CreateEntity(plBullet, CLASS_BULLET);
     m_vBulletSource = plBullet.pl_PositionVector;
-	// init bullet
-    EBulletInit eInit;
-    eInit.penOwner = m_penPlayer;
-    eInit.fDamage = fDamage;
-    penBullet->Initialize(eInit);
+    return CHitscanBullet(m_penPlayer, plBullet, fDamage);
   };
 
   // prepare Bullet
-  void PrepareBullet(FLOAT fX, FLOAT fY, FLOAT fDamage) {
+  // [Cecil] Prepare instant bullet without creating an entity
+  CHitscanBullet PrepareBullet(FLOAT fX, FLOAT fY, FLOAT fDamage) {
     // bullet start position
     CalcWeaponPosition(FLOAT3D(fX, fY, 0), plBullet, TRUE);
-    // create bullet
-    penBullet = CreateEntity(plBullet, CLASS_BULLET);
-    // init bullet
-    EBulletInit eInit;
-    eInit.penOwner = m_penPlayer;
-    eInit.fDamage = fDamage;
-    penBullet->Initialize(eInit);
+    return CHitscanBullet(m_penPlayer, plBullet, fDamage);
   };
 
   // fire one bullet
   void FireSniperBullet(FLOAT fX, FLOAT fY, FLOAT fRange, FLOAT fDamage, FLOAT fImprecission) {
-    PrepareSniperBullet(fX, fY, fDamage, fImprecission);
-    ((CBullet&)*penBullet).CalcTarget(fRange);
-    ((CBullet&)*penBullet).m_fBulletSize = 0.1f;
+    CHitscanBullet hb = PrepareSniperBullet(fX, fY, fDamage, fImprecission);
+    hb.CalcTarget(fRange);
+    hb.hb_fBulletSize = 0.1f;
     // launch bullet
-    ((CBullet&)*penBullet).LaunchBullet(TRUE, FALSE, TRUE);
+    hb.Launch(TRUE, FALSE);
     
-    if (((CBullet&)*penBullet).m_vHitPoint != FLOAT3D(0.0f, 0.0f, 0.0f)) {
-      m_vBulletTarget = ((CBullet&)*penBullet).m_vHitPoint;
+    if (hb.hb_vHitPoint != FLOAT3D(0.0f, 0.0f, 0.0f)) {
+      m_vBulletTarget = hb.hb_vHitPoint;
     } else if (TRUE) {
-      m_vBulletTarget = m_vBulletSource + FLOAT3D(0.0f, 0.0f, -500.0f)*((CBullet&)*penBullet).GetRotationMatrix();
+      m_vBulletTarget = m_vBulletSource + FLOAT3D(0.0f, 0.0f, -500.0f)*hb.hb_mRotation;
       
     }
 
@@ -2135,41 +2135,36 @@ functions:
     ese.betType = BET_SNIPER_RESIDUE;
     ese.vStretch = FLOAT3D(1.0f, 1.0f, 1.0f);
     ese.vNormal = m_vBulletSource;
-    ese.vDirection = ((CBullet&)*penBullet).m_vHitPoint;
+    ese.vDirection = hb.hb_vHitPoint;
     CPlacement3D pl = CPlacement3D(GetPlacement().pl_PositionVector, ANGLE3D(0.0f, 0.0f, 0.0f));
     CEntityPointer penFX = CreateEntity(pl, CLASS_BASIC_EFFECT);
     penFX->Initialize(ese);*/
-    
-	  // bullet no longer needed
-	  ((CBullet&)*penBullet).DestroyBullet();
   };
 
   // fire one bullet
   void FireOneBullet(FLOAT fX, FLOAT fY, FLOAT fRange, FLOAT fDamage) {
-    PrepareBullet(fX, fY, fDamage);
-    ((CBullet&)*penBullet).CalcTarget(fRange);
-    ((CBullet&)*penBullet).m_fBulletSize = 0.1f;
+    CHitscanBullet hb = PrepareBullet(fX, fY, fDamage);
+    hb.CalcTarget(fRange);
+    hb.hb_fBulletSize = 0.1f;
     // launch bullet
-    ((CBullet&)*penBullet).LaunchBullet(TRUE, FALSE, TRUE);
-    ((CBullet&)*penBullet).DestroyBullet();
+    hb.Launch(TRUE, FALSE);
   };
 
   // fire bullets (x offset is used for double shotgun)
   void FireBullets(FLOAT fX, FLOAT fY, FLOAT fRange, FLOAT fDamage, INDEX iBullets,
     FLOAT *afPositions, FLOAT fStretch, FLOAT fJitter) {
-    PrepareBullet(fX, fY, fDamage);
-    ((CBullet&)*penBullet).CalcTarget(fRange);
-    ((CBullet&)*penBullet).m_fBulletSize = GetSP()->sp_bCooperative ? 0.1f : 0.3f;
+    CHitscanBullet hb = PrepareBullet(fX, fY, fDamage);
+    hb.CalcTarget(fRange);
+    hb.hb_fBulletSize = GetSP()->sp_bCooperative ? 0.1f : 0.3f;
     // launch slugs
     INDEX iSlug;
     for (iSlug=0; iSlug<iBullets; iSlug++) {
       // launch bullet
-      ((CBullet&)*penBullet).CalcJitterTargetFixed(
+      hb.CalcJitterTargetFixed(
         afPositions[iSlug*2+0]*fRange*fStretch, afPositions[iSlug*2+1]*fRange*fStretch,
         fJitter*fRange*fStretch);
-      ((CBullet&)*penBullet).LaunchBullet(iSlug<2, FALSE, TRUE);
+      hb.Launch(iSlug<2, FALSE);
     }
-    ((CBullet&)*penBullet).DestroyBullet();
   };
 
   // fire one bullet for machine guns (tommygun and minigun)
@@ -2177,12 +2172,11 @@ functions:
     FLOAT fJitter, FLOAT fBulletSize)
   {
     fJitter*=fRange;  // jitter relative to range
-    PrepareBullet(fX, fY, fDamage);
-    ((CBullet&)*penBullet).CalcTarget(fRange);
-    ((CBullet&)*penBullet).m_fBulletSize = fBulletSize;
-    ((CBullet&)*penBullet).CalcJitterTarget(fJitter);
-    ((CBullet&)*penBullet).LaunchBullet(TRUE, FALSE, TRUE);
-    ((CBullet&)*penBullet).DestroyBullet();
+    CHitscanBullet hb = PrepareBullet(fX, fY, fDamage);
+    hb.CalcTarget(fRange);
+    hb.hb_fBulletSize = fBulletSize;
+    hb.CalcJitterTarget(fJitter);
+    hb.Launch(TRUE, FALSE);
   }
 
   // fire grenade
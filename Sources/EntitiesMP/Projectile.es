@@ -1587,7 +1587,7 @@ void LavaManBomb(void)
   {
     // spawn particle debris
     CPlacement3D plSpray = GetPlacement();
-    CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+    CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
     penSpray->SetParent( this);
     ESpawnSpray eSpawnSpray;
     eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1627,7 +1627,7 @@ void LavamanBombExplosion(void)
 
   // spawn particle debris
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1661,7 +1661,7 @@ void LavamanBombExplosion(void)
 
     // spawn particle debris
     CPlacement3D plSpray = pl;
-    CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+    CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
     penSpray->SetParent( penProjectile);
     ESpawnSpray eSpawnSpray;
     eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1701,7 +1701,7 @@ void LavamanBombDebrisExplosion(void)
 
   // spawn particle debris
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1884,7 +1884,7 @@ void BeastDebrisExplosion(void)
 
   // spawn particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1907,7 +1907,7 @@ void BeastBigDebrisExplosion(void)
 
   // spawn particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1930,7 +1930,7 @@ void BeastProjectileExplosion(void)
 
   // particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1964,7 +1964,7 @@ void BeastProjectileExplosion(void)
 
     // spawn particle debris
     CPlacement3D plSpray = pl;
-    CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+    CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
     penSpray->SetParent( penProjectile);
     ESpawnSpray eSpawnSpray;
     eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -1988,7 +1988,7 @@ void BeastBigProjectileExplosion(void)
 
   // particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2020,7 +2020,7 @@ void BeastBigProjectileExplosion(void)
 
     // spawn particle debris
     CPlacement3D plSpray = pl;
-    CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+    CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
     penSpray->SetParent( penProjectile);
     ESpawnSpray eSpawnSpray;
     eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2227,7 +2227,7 @@ void DevilGuidedProjectileExplosion(void)
 
   // particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2259,7 +2259,7 @@ void DevilGuidedProjectileExplosion(void)
 
     // spawn particle debris
     CPlacement3D plSpray = pl;
-    CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+    CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
     penSpray->SetParent( penProjectile);
     ESpawnSpray eSpawnSpray;
     eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2533,7 +2533,7 @@ void DemonFireballExplosion(void)
 
   // particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2604,7 +2604,7 @@ void LarvaPlasmaExplosion(void) {
 
   // particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2732,7 +2732,7 @@ void MeteorExplosion() {
   //PlayerRocketExplosion();
   // spawn particle debris
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2826,7 +2826,7 @@ void ShooterWoodenDart(void) {
 void ShooterWoodenDartExplosion() {
   // particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -2874,7 +2874,7 @@ void ShooterFireball(void) {
 void ShooterFireballExplosion() {
   // particles
   CPlacement3D plSpray = GetPlacement();
-  CEntityPointer penSpray = CreateEntity( plSpray, CLASS_BLOOD_SPRAY);
+  CEntityPointer penSpray = CreateRecycledSpray(this, plSpray); // [Cecil] 2026-10-19: Reuse finished sprays
   penSpray->SetParent( this);
   ESpawnSpray eSpawnSpray;
   eSpawnSpray.colBurnColor=C_WHITE|CT_OPAQUE;
@@ -3031,7 +3031,7 @@ void ProjectileHit(void)
 
 // spawn effect
 void SpawnEffect(const CPlacement3D &plEffect, const ESpawnEffect &eSpawnEffect) {
-  CEntityPointer penEffect = CreateEntity(plEffect, CLASS_BASIC_EFFECT);
+  CEntityPointer penEffect = CreateRecycledEffect(this, plEffect); // [Cecil] 2026-10-19: Reuse finished effects
   penEffect->Initialize(eSpawnEffect);
 };
 
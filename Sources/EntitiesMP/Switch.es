@@ -43,6 +43,12 @@ components:
 
 functions:                                        
 
+  // [Cecil] Change usability and notify bots about it
+  void SetUseable(BOOL bUseable) {
+    m_bUseable = bUseable;
+    CECIL_ImportantEntityChanged(this);
+  };
+
   /* Get anim data for given animation property - return NULL for none. */
   CAnimData *GetAnimData(SLONG slPropertyOffset) 
   {
@@ -138,44 +144,44 @@ procedures:
   };
 
   MainLoop_Once() {
-    m_bUseable = TRUE;
+    SetUseable(TRUE); // [Cecil]
 
     //main loop
     wait() {
       // trigger event -> change switch
       on (ETrigger eTrigger) : {
         if (CanReactOnEntity(eTrigger.penCaused) && m_bUseable) {
-          m_bUseable = FALSE;
+          SetUseable(FALSE); // [Cecil]
           m_penCaused = eTrigger.penCaused;
           call SwitchON();
         }
       }
       // start -> switch ON
       on (EStart) : {
-        m_bUseable = FALSE;
+        SetUseable(FALSE); // [Cecil]
         call SwitchON();
       }
       // stop -> switch OFF
       on (EStop) : {
-        m_bUseable = FALSE;
+        SetUseable(FALSE); // [Cecil]
         call SwitchOFF();
       }
       on (EReturn) : {
-        m_bUseable = !m_bSwitchON;
+        SetUseable(!m_bSwitchON); // [Cecil]
         resume;
       }
     }
   };
 
   MainLoop_OnOff() {
-    m_bUseable = TRUE;
+    SetUseable(TRUE); // [Cecil]
 
     //main loop
     wait() {
       // trigger event -> change switch
       on (ETrigger eTrigger) : {
         if (CanReactOnEntity(eTrigger.penCaused) && m_bUseable) {
-          m_bUseable = FALSE;
+          SetUseable(FALSE); // [Cecil]
           m_penCaused = eTrigger.penCaused;
           // if switch is ON make it OFF
           if (m_bSwitchON) {
@@ -188,12 +194,12 @@ procedures:
       }
       // start -> switch ON
       on (EStart) : {
-        m_bUseable = FALSE;
+        SetUseable(FALSE); // [Cecil]
         call SwitchON();
       }
       // stop -> switch OFF
       on (EStop) : {
-        m_bUseable = FALSE;
+        SetUseable(FALSE); // [Cecil]
         call SwitchOFF();
       }
       // when dead
@@ -204,7 +210,7 @@ procedures:
         resume;
       }
       on (EReturn) : {
-        m_bUseable = TRUE;
+        SetUseable(TRUE); // [Cecil]
         resume;
       }
     }
@@ -52,6 +52,10 @@ properties:
  41 CEntityPointer m_penCaused,     // who touched it last time
  42 INDEX m_ctMaxTrigs            "Max trigs" 'X' = -1, // how many times could trig
 
+  {
+    CWorldCount m_wcCount; // [Cecil] 2026-10-19: what this trigger adds to the world totals
+  }
+
 
 components:
 
@@ -68,6 +72,36 @@ functions:
   }
 
 
+  // [Cecil] 2026-10-19: Update what this trigger adds to the world totals
+  void UpdateWorldCount(void)
+  {
+    // triggers with score are secrets
+    m_wcCount.Set(GetWorld(), 0, (m_fScore>0 ? 1 : 0));
+  }
+
+  // [Cecil] 2026-10-19: Count in the world totals
+  void OnInitialize(const CEntityEvent &eeInput)
+  {
+    UpdateWorldCount();
+    CRationalEntity::OnInitialize(eeInput);
+  }
+
+  // [Cecil] 2026-10-19: Remove from the world totals
+  void OnEnd(void)
+  {
+    m_wcCount.Set(NULL, 0, 0);
+    CRationalEntity::OnEnd();
+  }
+
+  /* Read from stream. */
+  void Read_t( CTStream *istr) // throw char *
+  {
+    CRationalEntity::Read_t(istr);
+
+    // [Cecil] 2026-10-19: Count in the world totals
+    UpdateWorldCount();
+  }
+
   // returns bytes of memory used by this object
   SLONG GetUsedMemory(void)
   {
@@ -128,6 +162,7 @@ procedures:
 
       // kill score to never be reported again
       m_fScore = 0;
+      UpdateWorldCount(); // [Cecil] 2026-10-19
     }
     if (m_strMessage!="") {
       PrintCenterMessage(this, m_penCaused, 
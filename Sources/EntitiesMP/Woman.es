@@ -57,6 +57,12 @@ components:
  55 sound   SOUND_DEATH     "Models\\Enemies\\Woman\\Sounds\\Death.wav",
 
 functions:
+  // [Cecil] 2026-10-19: Kamikaze carrier counts as two enemies
+  INDEX GetTotalCount(void)
+  {
+    return (m_bKamikazeCarrier ? 2 : 1);
+  }
+
   // describe how this enemy killed player
   virtual CTString GetPlayerKillDescription(const CTString &strPlayerName, const EDeath &eDeath)
   {
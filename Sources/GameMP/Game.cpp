@@ -193,6 +193,26 @@ static void ReportDemoProfile(void)
   CPrintF( "-\n");
 }
 
+// [Cecil] 2026-10-19: Replay a bot match demo as fast as possible and write a report next to it
+static void BenchmarkBotDemo(const CTString &strDemo)
+{
+  CTFileName fnDemo = strDemo;
+
+  // look in the benchmark directory by default
+  if (fnDemo.FileDir()=="") {
+    fnDemo = CTString(BOT_BENCHMARK_DIR) + fnDemo;
+  }
+  if (fnDemo.FileExt()=="") {
+    fnDemo += ".dem";
+  }
+
+  if (!_pGame->StartDemoPlay(fnDemo)) {
+    return;
+  }
+
+  CECIL_BeginBotBenchmark(fnDemo);
+}
+
 #define MAX_SCRIPTSOUNDS 16
 static CSoundObject *_apsoScriptChannels[MAX_SCRIPTSOUNDS] = {0};
 
@@ -903,6 +923,7 @@ void CGame::InitInternal( void)
   _pShell->DeclareSymbol("user INDEX dem_iAnimFrame;",       &dem_iAnimFrame);
   _pShell->DeclareSymbol("user CTString dem_strPostExec;",   &dem_strPostExec);
   _pShell->DeclareSymbol("persistent user INDEX dem_iProfileRate;",  &dem_iProfileRate);
+  _pShell->DeclareSymbol("user void " MODCOM_NAME("BenchmarkDemo(CTString);"), &BenchmarkBotDemo); // [Cecil]
   _pShell->DeclareSymbol("persistent user INDEX hud_bShowNetGraph;", &hud_bShowNetGraph);
   _pShell->DeclareSymbol("FLOAT gam_afEnemyMovementSpeed[5];", &gam_afEnemyMovementSpeed);
   _pShell->DeclareSymbol("FLOAT gam_afEnemyAttackSpeed[5];",   &gam_afEnemyAttackSpeed);
@@ -2132,6 +2153,23 @@ void CGame::GameRedrawView( CDrawPort *pdpDrawPort, ULONG ulFlags)
     SE_PretouchIfNeeded();
   }
 
+  // [Cecil] 2026-10-19: Don't render the game while benchmarking bots
+  if (CECIL_IsBotBenchmarkActive()) {
+    if (pdpDrawPort->Lock()) {
+      pdpDrawPort->Fill(C_BLACK|CT_OPAQUE);
+
+      CTString strProgress;
+      strProgress.PrintF("Bot benchmark: %.1fs", _pNetwork->ga_fDemoTimer);
+
+      pdpDrawPort->SetFont(_pfdDisplayFont);
+      pdpDrawPort->SetTextScaling(1.0f);
+      pdpDrawPort->SetTextAspect(1.0f);
+      pdpDrawPort->PutTextC(strProgress, pdpDrawPort->GetWidth()*0.5f, pdpDrawPort->GetHeight()*0.5f, C_WHITE|CT_OPAQUE);
+      pdpDrawPort->Unlock();
+    }
+    return;
+  }
+
   // if game is started and computer isn't on
   BOOL bClientJoined = FALSE;
   if( gm_bGameOn && (_pGame->gm_csComputerState==CS_OFF || pdpDrawPort->IsDualHead()) 
@@ -2686,7 +2724,9 @@ void CGame::GameMainLoop(void)
     _pfSoundProfile.Reset();
     _pfNetworkProfile.Reset();
     _pfPhysicsProfile.Reset();
+    _pfBotModProfile.Reset(); // [Cecil] 2026-10-19
   } else if (_bProfiling) {
+    _pfBotModProfile.IncrementAveragingCounter(); // [Cecil] 2026-10-19: Bot mod profile is per frame
     _ctProfileRecording--;
     if (_ctProfileRecording<=0) {
       _bProfiling = FALSE;
@@ -2728,10 +2768,28 @@ void CGame::GameMainLoop(void)
       _strProfile+=strPhysicsReport;
       _pfPhysicsProfile.Reset();
 
+      // [Cecil] 2026-10-19: Bot mod profile
+      CTString strBotModReport;
+      _pfBotModProfile.Report(strBotModReport);
+      _strProfile+=strBotModReport;
+      _pfBotModProfile.Reset();
+
       CPrintF( TRANS("Profiling done.\n"));
     }
   }
 
+  // [Cecil] 2026-10-19: Finish benchmarking bots
+  if (CECIL_IsBotBenchmarkActive()) {
+    // game has been stopped early
+    if (!gm_bGameOn) {
+      CECIL_EndBotBenchmark(FALSE);
+
+    } else if (_pNetwork->IsDemoPlayFinished()) {
+      CECIL_EndBotBenchmark(TRUE);
+      StopGame();
+    }
+  }
+
   if (_bDumpNextTime) {
     _bDumpNextTime = FALSE;
     try {